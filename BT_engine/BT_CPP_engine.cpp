@@ -8,6 +8,7 @@
 
 #include <behaviortree_cpp/bt_factory.h>
 #include <BT_CPP_leaves/btCpp_common.h>
+#include <BT_CPP_leaves/btCpp_tickBatch.h>
 
 #include <behaviortree_cpp/blackboard.h>
 
@@ -55,6 +56,7 @@ class BT_Engine : public yarp::os::RFModule
 {
 private:
     double period;
+    bool   batch_conditions;
 
     // We use the BehaviorTreeFactory to register our custom nodes
     Tree tree;
@@ -73,6 +75,9 @@ public:
 
         period = rf.check("period", Value(0.020)).asDouble();
 
+        // tick the conditions opted in with batch="true" bound to the same server with a single message per cycle
+        batch_conditions = !rf.check("no_batch");
+
 
         //
         // Handle BT description xml file
@@ -209,6 +214,12 @@ public:
             params.fromConfigFile(param_file_path);
             yDebug() << params.toString();
         }
+        params.put("batch_conditions", Value(batch_conditions));
+
+        // default deadline for the RPCs of all nodes, each node can override it with its <timeout> port;
+        // none by default, a synchronous halt may take long
+        if(!params.check("rpc_timeout"))
+            params.put("rpc_timeout", rf.check("rpc_timeout", Value(0.0)).asDouble());
 
         // Trees are created at deployment-time (i.e. at run-time, but only once at the beginning).
         // The currently supported format is XML.
@@ -285,6 +296,8 @@ public:
         yDebug() << "start running the BT ";
 
         std::cout << "\nIteration num " << i++ << "\n";
+        if(batch_conditions)
+            bt_cpp_modules::BtCppTickBatch::instance().beginCycle();
         tree.root_node->executeTick();
 
         return true;
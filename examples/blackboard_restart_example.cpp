@@ -0,0 +1,119 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file blackboard_restart_example.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+/*
+ * Content of a persistent BlackBoard across a restart of the BlackBoard and of the BT engine.
+ *
+ *   blackboard_module --persistence_dir /tmp/bb &
+ *   blackboard_restart_example write          # writes a target, and one expiring after 20 seconds
+ *   (stop the blackboard_module and start it again with the same --persistence_dir, within 20 seconds)
+ *   blackboard_restart_example check          # the target is still there, the other one expires in time
+ *
+ * Both steps also start like a BT engine does, i.e. every node calls request_initialize on the BlackBoard,
+ * which must not touch the content of a persistent BlackBoard.
+ * The repository has no test suite, so checks like this one are shipped as example programs:
+ * it prints OK or FAILED and exits with a failure status if the target was lost, or if the expiring one
+ * is still there after its time to live.
+ */
+
+//standard imports
+#include <string>
+#include <cstdlib>
+
+//YARP imports
+#include <yarp/os/Network.h>    // for yarp::os::Network
+#include <yarp/os/Property.h>
+#include <yarp/os/Time.h>
+#include <yarp/os/LogStream.h>  // for yError()
+
+//behavior trees imports
+#include <yarp/BT_wrappers/tick_client.h>
+#include <yarp/BT_wrappers/blackboard_client.h>
+
+using namespace yarp::BT_wrappers;
+using namespace yarp::os;
+
+static const char *TARGET     = "restart_example";
+static const char *TTL_TARGET = "restart_example_ttl";
+static const double TTL       = 20.0;
+
+int main(int argc, char * argv[])
+{
+    /* initialize yarp network */
+    yarp::os::Network yarp;
+    if (!yarp::os::Network::checkNetwork(5.0))
+    {
+        yError() << " YARP server not available!";
+        return EXIT_FAILURE;
+    }
+
+    std::string step = (argc > 1) ? argv[1] : "";
+    if(step != "write" && step != "check")
+    {
+        yError() << "Usage: blackboard_restart_example write|check";
+        return EXIT_FAILURE;
+    }
+
+    BlackBoardClient blackboard;
+    TickClient       node;
+    blackboard.setTimeout(1.0);
+    node.setTimeout(1.0);
+    if(!blackboard.configureBlackBoardClient("/BlackBoardRestart", "client") || !blackboard.connectToBlackBoard() ||
+       !node.configure_TickClient("/BlackBoardRestart", "node") || !node.connect("/blackboard"))
+    {
+        yError() << "Cannot connect to the blackboard, is blackboard_module running?";
+        return EXIT_FAILURE;
+    }
+
+    if(step == "write")
+    {
+        Property datum;
+        datum.put("found", true);
+        datum.put("seen_at", Time::now());
+        if(!blackboard.setData(TARGET, datum))
+        {
+            yError() << "setData failed";
+            return EXIT_FAILURE;
+        }
+
+        Property expiring;
+        expiring.put("expires_at", Time::now() + TTL);
+        if(!blackboard.setDataWithTTL(TTL_TARGET, expiring, TTL))
+        {
+            yError() << "setDataWithTTL failed";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // the engine starting again
+    bool ok = node.request_initialize();
+
+    Property data = blackboard.getData(TARGET);
+    ok = ok && data.check("found") && data.find("found").asBool();
+    yInfo() << step << ": target" << TARGET << "is" << data.toString() << ":" << (ok ? "OK" : "FAILED");
+
+    if(step == "check")
+    {
+        // missing if the restart took longer than its time to live, otherwise gone once expired
+        Property expiring = blackboard.getData(TTL_TARGET);
+        if(expiring.check("expires_at"))
+        {
+            double wait = expiring.find("expires_at").asFloat64() - Time::now();
+            if(wait > 0.0)
+                Time::delay(wait + 0.5);
+            expiring = blackboard.getData(TTL_TARGET);
+            ok = ok && !expiring.check("expires_at");
+        }
+        yInfo() << step << ": target" << TTL_TARGET << "after its time to live is" << expiring.toString() << ":" << (ok ? "OK" : "FAILED");
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,155 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file parallel_targets_example.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+/*
+ * A single threaded TickServer driven by one client on N different targets.
+ * Each target runs for a different amount of time, the first one is halted while running.
+ * Since completion is tracked per action, the targets complete independently: the whole
+ * run lasts about as long as the slowest target and halting one target does not wait
+ * for the others.
+ *
+ * The repository has no test suite, so checks like this one are shipped as example programs:
+ * it prints OK or FAILED and exits with a failure status if the targets did not complete
+ * independently. Usage: parallel_targets_example [N], with N >= 2 targets (default 4).
+ */
+
+//standard imports
+#include <map>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <iostream>             // for std::cout
+
+//YARP imports
+#include <yarp/os/Network.h>    // for yarp::os::Network
+#include <yarp/os/Property.h>
+#include <yarp/os/LogStream.h>  // for yError()
+
+//behavior trees imports
+#include <yarp/BT_wrappers/tick_server.h>
+#include <yarp/BT_wrappers/tick_client.h>
+
+using namespace yarp::BT_wrappers;
+using namespace yarp::os;
+
+class ParallelSkill : public TickServer
+{
+public:
+    ~ParallelSkill()
+    {
+        // the workers call request_tick of this class, stop them before it is destroyed
+        close_TickServer();
+    }
+
+    ReturnStatus request_tick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params) override
+    {
+        auto duration = std::chrono::milliseconds(params.find("duration_ms").asInt32());
+        auto start    = std::chrono::steady_clock::now();
+
+        while(std::chrono::steady_clock::now() - start < duration)
+        {
+            if(isHaltRequested(target))
+            {
+                yInfo() << "Target" << target.target << "halted";
+                return BT_FAILURE;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return BT_SUCCESS;
+    }
+
+    ReturnStatus request_halt(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params = {}) override
+    {
+        return BT_HALTED;
+    }
+};
+
+int main(int argc, char * argv[])
+{
+    /* initialize yarp network */
+    yarp::os::Network yarp;
+    if (!yarp::os::Network::checkNetwork(5.0))
+    {
+        yError() << " YARP server not available!";
+        return EXIT_FAILURE;
+    }
+
+    int N = (argc > 1) ? std::atoi(argv[1]) : 4;
+    if(N < 2)
+        N = 2;
+
+    ParallelSkill skill;
+    if(!skill.configure_TickServer("/ParallelExample", "server", true, N))
+        return EXIT_FAILURE;
+
+    TickClient client;
+    client.configure_TickClient("/ParallelExample", "client");
+    client.connect("/ParallelExample/server");
+
+    // target i lasts (i+1) seconds
+    std::map<int, ActionID>      actions;
+    std::map<int, Property>      params;
+    std::map<int, ReturnStatus>  result;
+    std::map<int, double>        elapsed;
+    for(int i=0; i<N; i++)
+    {
+        actions[i].action_ID = i + 1;
+        actions[i].target    = "target_" + std::to_string(i);
+        params[i].put("duration_ms", (i + 1) * 1000);
+        result[i] = BT_IDLE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto seconds_since_start = [&start] {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    bool halt_sent = false;
+    int  completed = 0;
+    while(completed < N)
+    {
+        for(int i=0; i<N; i++)
+        {
+            if(result[i] != BT_IDLE && result[i] != BT_RUNNING)
+                continue;
+
+            result[i] = client.request_tick(actions[i], params[i]);
+
+            // halt the first target after half a second, while it is still running
+            if(i == 0 && !halt_sent && result[i] == BT_RUNNING && seconds_since_start() > 0.5)
+            {
+                result[i] = client.request_halt(actions[i]);
+                halt_sent = true;
+            }
+
+            if(result[i] != BT_IDLE && result[i] != BT_RUNNING)
+            {
+                elapsed[i] = seconds_since_start();
+                completed++;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    ReturnStatusVocab vocab;
+    for(int i=0; i<N; i++)
+        yInfo() << actions[i].target << "completed with" << vocab.toString(result[i]) << "after" << elapsed[i] << "s";
+
+    // Targets running in parallel: the total time is close to the slowest target, not to the sum of them
+    double total = seconds_since_start();
+    bool ok = (result[0] == BT_HALTED) && (elapsed[0] < 1.0) && (total < N + 0.5);
+    for(int i=1; i<N; i++)
+        ok = ok && (result[i] == BT_SUCCESS);
+
+    yInfo() << N << "targets completed in" << total << "s:" << (ok ? "OK" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
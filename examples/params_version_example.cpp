@@ -0,0 +1,122 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file params_version_example.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+/*
+ * Ticks whose params come from the BlackBoard, as sent by the nodes of the BT engine: the params are read with their
+ * version and sent to the server only when the target changed, the other ticks carry the version alone.
+ *
+ *   blackboard_module &
+ *   params_version_example [ticks]     # default 10 ticks for each content of the target
+ *
+ * The repository has no test suite, so checks like this one are shipped as example programs:
+ * it prints OK or FAILED and exits with a failure status if the params were sent more than once per content of
+ * the target, or if the server did not tick with the last content.
+ */
+
+//standard imports
+#include <atomic>
+#include <string>
+#include <cstdlib>
+
+//YARP imports
+#include <yarp/os/Network.h>    // for yarp::os::Network
+#include <yarp/os/Property.h>
+#include <yarp/os/LogStream.h>  // for yError()
+
+//behavior trees imports
+#include <yarp/BT_wrappers/tick_server.h>
+#include <yarp/BT_wrappers/tick_client.h>
+#include <yarp/BT_wrappers/blackboard_client.h>
+
+using namespace yarp::BT_wrappers;
+using namespace yarp::os;
+
+static const char *TARGET = "params_version_example";
+
+class SpeedSkill : public TickServer
+{
+public:
+    std::atomic<int> lastSpeed {0};
+
+    ReturnStatus request_tick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params) override
+    {
+        lastSpeed = params.find("speed").asInt32();
+        return BT_SUCCESS;
+    }
+
+    ReturnStatus request_halt(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params = {}) override
+    {
+        return BT_HALTED;
+    }
+};
+
+int main(int argc, char * argv[])
+{
+    /* initialize yarp network */
+    yarp::os::Network yarp;
+    if (!yarp::os::Network::checkNetwork(5.0))
+    {
+        yError() << " YARP server not available!";
+        return EXIT_FAILURE;
+    }
+
+    int ticks = (argc > 1) ? std::atoi(argv[1]) : 10;
+    if(ticks < 2)
+        ticks = 2;
+
+    SpeedSkill skill;
+    if(!skill.configure_TickServer("/ParamsVersionExample", "server"))
+        return EXIT_FAILURE;
+
+    BlackBoardClient blackboard;
+    TickClient       client;
+    if(!blackboard.configureBlackBoardClient("/ParamsVersionExample", "blackboard") || !blackboard.connectToBlackBoard() ||
+       !client.configure_TickClient("/ParamsVersionExample", "client") || !client.connect("/ParamsVersionExample/server"))
+    {
+        yError() << "Cannot connect to the blackboard, is blackboard_module running?";
+        return EXIT_FAILURE;
+    }
+
+    ActionID action;
+    action.action_ID = 1;
+    action.target    = TARGET;
+    if(!client.registerTarget(action))
+    {
+        yError() << "Cannot register the target on the server";
+        return EXIT_FAILURE;
+    }
+
+    bool ok = true;
+    const int contents = 3;
+    for(int speed=1; speed<=contents; speed++)
+    {
+        Property datum;
+        datum.put("speed", speed);
+        ok = ok && blackboard.setData(TARGET, datum);
+
+        for(int i=0; i<ticks; i++)
+        {
+            auto tick = client.request_tick_async(action, [&blackboard](std::int64_t &version) {
+                return blackboard.getData(TARGET, version);
+            });
+            ok = ok && tick.get() == BT_SUCCESS;
+        }
+        ok = ok && skill.lastSpeed == speed;
+    }
+
+    std::int64_t skipped = client.getStats().find("params_skipped").asInt64();
+    ok = ok && skipped == contents * (ticks - 1);
+    blackboard.clearData(TARGET);
+
+    yInfo() << contents * ticks << "ticks," << skipped << "of them without params, expected" << contents * (ticks - 1) << ":" << (ok ? "OK" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
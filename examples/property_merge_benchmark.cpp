@@ -0,0 +1,133 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file property_merge_benchmark.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+/*
+ * Cost of a setData on the BlackBoard side: reading the datum from the network and merging it into the stored target.
+ * The datum is read as a PropertyEntries and its entries are merged as they are, compared with what the BlackBoard
+ * did before: reading a plain Property and merging it with m_storage[target].fromString(datum.toString(), false).
+ *
+ * The repository has no test suite, so benchmarks like this one are shipped as example programs: it prints the
+ * time per merge of both ways, and exits with a failure status if they do not produce the same target.
+ * No YARP server is needed. Usage: property_merge_benchmark [keys] [iterations]; by default both a small (4 keys)
+ * and a large (200 keys) datum are measured, with 5000 iterations each.
+ */
+
+//standard imports
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <cstdlib>
+
+//YARP imports
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/LogStream.h>
+#include <yarp/os/DummyConnector.h>
+
+//behavior trees imports
+#include <yarp/BT_wrappers/property_merge.h>
+
+using namespace yarp::BT_wrappers;
+using namespace yarp::os;
+
+// datum with <keys> entries of different types, <seed> changes the values
+static Property makeDatum(int keys, int seed)
+{
+    Property datum;
+    for(int k=0; k<keys; k++)
+    {
+        std::string key = "key_" + std::to_string(k);
+        switch(k % 4)
+        {
+            case 0: datum.put(key, seed + k);                                   break;
+            case 1: datum.put(key, 0.5 * (seed + k));                           break;
+            case 2: datum.put(key, "value_" + std::to_string(seed + k));        break;
+            default:
+            {
+                Value *pose = Value::makeList();
+                pose->asList()->addFloat64(seed);
+                pose->asList()->addFloat64(k);
+                pose->asList()->addFloat64(0.0);
+                datum.put(key, pose);
+            }
+        }
+    }
+    return datum;
+}
+
+// merge as done by the BlackBoard before
+static void mergeThroughText(Property &dst, const Property &src)
+{
+    dst.fromString(src.toString(), false);
+}
+
+// time both ways with a datum of <keys> entries, false if the merged targets differ
+static bool run(int keys, int iterations)
+{
+    Property before, after;
+    std::chrono::steady_clock::duration textTime {0}, entriesTime {0};
+
+    for(int i=0; i<iterations; i++)
+    {
+        // every other write repeats the previous one, so half of the merges change nothing
+        Property sent = makeDatum(keys, i / 2);
+
+        DummyConnector textWire, entriesWire;
+        sent.write(textWire.getWriter());
+        sent.write(entriesWire.getWriter());
+
+        auto start = std::chrono::steady_clock::now();
+        Property plain;
+        plain.read(textWire.getReader());
+        mergeThroughText(before, plain);
+        auto middle = std::chrono::steady_clock::now();
+        PropertyEntries received;
+        received.read(entriesWire.getReader());
+        mergeProperty(after, received);
+        auto end = std::chrono::steady_clock::now();
+
+        textTime    += middle - start;
+        entriesTime += end - middle;
+    }
+
+    bool ok = true;
+    Property last = makeDatum(keys, (iterations - 1) / 2);
+    for(int k=0; k<keys; k++)
+    {
+        std::string key = "key_" + std::to_string(k);
+        ok = ok && before.find(key).toString() == last.find(key).toString()
+                && after.find(key).toString()  == last.find(key).toString();
+    }
+
+    auto perMerge = [iterations](std::chrono::steady_clock::duration total) {
+        return std::chrono::duration<double, std::micro>(total).count() / iterations;
+    };
+    yInfo() << keys << "keys," << iterations << "merges";
+    yInfo() << "through text:   " << perMerge(textTime)    << "us per merge";
+    yInfo() << "through entries:" << perMerge(entriesTime) << "us per merge";
+    yInfo() << "merged targets" << (ok ? "match: OK" : "differ: FAILED");
+    return ok;
+}
+
+int main(int argc, char * argv[])
+{
+    int iterations = (argc > 2) ? std::atoi(argv[2]) : 5000;
+    if(iterations < 1)
+        iterations = 1;
+
+    if(argc > 1)
+        return run(std::max(std::atoi(argv[1]), 1), iterations) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    bool ok = run(4, iterations);
+    ok = run(200, iterations) && ok;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
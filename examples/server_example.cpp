@@ -31,7 +31,11 @@ public:
     {
         ReturnStatus ret = BT_ERROR;
 
-        yDebug() << "Server example" << target.target << " with params " << params.toString();
+        // per-action data, starts from 0 each time the action is started again
+        int &ticks = getData(target);
+        ticks++;
+
+        yDebug() << "Server example" << target.target << " with params " << params.toString() << " tick number " << ticks;
 
         if(target.target == "Always_Success")
             ret = BT_SUCCESS;
@@ -12,6 +12,7 @@
  */
 
 #include "btCpp_checkCondition.h"
+#include "btCpp_tickBatch.h"
 
 #include <thread>
 #include <iostream>
@@ -33,7 +34,6 @@ BtCppCheckCondition::BtCppCheckCondition(const std::string& name, const BT::Node
 
 bool BtCppCheckCondition::initialize(Searchable &params)
 {
-    YARP_UNUSED(params);
     m_portPrefix = "/BT_engine/" + std::to_string(UID());
     m_clientName = this->name();
 
@@ -54,6 +54,9 @@ bool BtCppCheckCondition::initialize(Searchable &params)
         yInfo() << "<serverPort> parameter for node <" + this->name() + "> is missing, using default <" + m_serverPort + ">.";
     }
 
+    m_timeout = rpcTimeout(*this, params);
+    m_tickClient.setTimeout(m_timeout);
+
     if(!m_tickClient.connect(m_serverPort) )
     {
         yError() << "Failed to connect the module <" + this->name() + "> to <" + m_serverPort + "> port.";
@@ -62,7 +65,6 @@ bool BtCppCheckCondition::initialize(Searchable &params)
     else
         yInfo() << "Succesfully connected the module <" + this->name() + "> to <" + m_serverPort + "< port.";
 
-
     if(!m_tickClient.request_initialize())
     {
         yError() << "Node" << this->name() << ": Failed to initialize";
@@ -88,6 +90,18 @@ bool BtCppCheckCondition::initialize(Searchable &params)
     m_targetId.resources = {};
 
     m_prop.put("flag", flagName.value());
+
+    // from now on ticks carry a compact handle instead of the whole ActionID, if the server supports it
+    m_tickClient.registerTarget(m_targetId);
+
+    // tick this condition together with the others bound to the same server, only if the tree
+    // declares it free of side effects: a batch ticks it even when the tree does not reach it
+    Optional<bool> batch = getInput<bool>("batch");
+    if(batch && batch.value() && params.check("batch_conditions", Value(true)).asBool() &&
+       !BtCppTickBatch::instance().add(m_serverPort, m_targetId, m_prop, m_timeout))
+    {
+        yWarning() << "Node" << this->name() << ": cannot be ticked in batch, it will send its own ticks";
+    }
     return true;
 }
 
@@ -101,7 +115,10 @@ bool BtCppCheckCondition::terminate()
 BT::NodeStatus BtCppCheckCondition::tick()
 {
     yInfo() << "BtCppCheckCondition::tick() " << this->name();
-    BT::NodeStatus ret = toBT_cpp(m_tickClient.request_tick(m_targetId, m_prop));
+    ReturnStatus status;
+    if(!BtCppTickBatch::instance().take(m_serverPort, m_targetId.action_ID, status))
+        status = m_tickClient.request_tick(m_targetId, m_prop);
+    BT::NodeStatus ret = toBT_cpp(status);
     yInfo() << "BtCppCheckCondition::tick() " << this->name() << " ret: " << toStr(ret);
     setStatus(ret);
     return ret;
@@ -44,13 +44,17 @@ public:
     {
         return { BT::InputPort("target",        "Name of the target this action is refeered to. Ex: <bottle>"),
                  BT::InputPort("flag",          "Name of the flag to check, ex: <found>"),
-                 BT::InputPort("serverPort",    "YARP Port Name to connect to.")
+                 BT::InputPort("serverPort",    "YARP Port Name to connect to."),
+                 BT::InputPort("timeout",       "Max time in seconds to wait for the reply of the server. Default from engine parameter <rpc_timeout>."),
+                 BT::InputPort("batch",         "true to tick this condition together with the others on the same server. "
+                                                "Only for checks without side effects, false by default.")
         };
     }
 private:
     std::string             m_portPrefix;
     std::string             m_clientName;
     std::string             m_serverPort;
+    double                  m_timeout {0.0};
     yarp::BT_wrappers::TickClient  m_tickClient;
 
     // Store target and relative flag to check when ticked. This implementation
@@ -82,6 +82,8 @@ bool BtCppCheckRobotAtLocation::initialize(Searchable &params)
         return false;
     }
     m_targetName = targetName.value();
+    // the location is read at each tick, let the blackboard push its changes instead
+    m_blackboardClient.watch(m_targetName);
     return true;
 }
 
@@ -13,6 +13,7 @@
 
 #include "btCpp_client.h"
 #include "btCpp_common.h"
+#include "btCpp_tickBatch.h"
 
 #include <memory>
 #include <iostream>
@@ -28,10 +29,19 @@ using namespace bt_cpp_modules;
 BtCppClient::BtCppClient(const string &name, const BT::NodeConfiguration &config)  : ActionNodeBase(name, config)
 { }
 
+BtCppClient::~BtCppClient()
+{
+    // the pending requests use the blackboard client and m_params; a halt is sent after the tick it follows
+    if(m_pendingTick.valid())
+        m_pendingTick.wait();
+    if(m_pendingHalt.valid())
+        m_pendingHalt.wait();
+}
+
 bool BtCppClient::connect(std::string serverName)
 {
-    // connect to server
-    bool ret = m_tickClient.connect(serverName);
+    // connect to server, and subscribe to its completion notifications if available
+    bool ret = m_tickClient.connect(serverName, true);
     if(!ret)
     {
         yError() << "Failed to connect the module <" + this->name() + "> to <" + serverName + "> port.";
@@ -56,8 +66,6 @@ bool BtCppClient::connect(std::string serverName)
 
 bool BtCppClient::initialize(Searchable &params)
 {
-    YARP_UNUSED(params);
-
     bool ret{true};
     string clientName = this->name() + "/" + std::to_string(UID());
     ret &= m_tickClient.configure_TickClient("/BT_engine", clientName);
@@ -82,6 +90,11 @@ bool BtCppClient::initialize(Searchable &params)
         return false;
     }
 
+    // no request is sent without the timeout, including the ones made while connecting
+    double timeout = rpcTimeout(*this, params);
+    m_tickClient.setTimeout(timeout);
+    m_blackBoardClient.setTimeout(timeout);
+
     if(!connect(m_serverPort) )
     {
         yError() << "cannot connect to port <" + m_serverPort + ">";
@@ -94,6 +107,8 @@ bool BtCppClient::initialize(Searchable &params)
     if(targetName)
     {
         m_targetId.target = targetName.value();
+        // the params are read at each tick, let the blackboard push their changes instead
+        m_blackBoardClient.watch(m_targetId.target);
     }
     else
     {
@@ -112,6 +127,9 @@ bool BtCppClient::initialize(Searchable &params)
         return false;
     }
 
+    // from now on ticks carry a compact handle instead of the whole ActionID, if the server supports it
+    m_tickClient.registerTarget(m_targetId);
+
     yDebug() << "Node <" + this->name() + "> : initialization done!";
     return true;
 }
@@ -126,28 +144,59 @@ NodeStatus BtCppClient::tick()
 {
     yInfo() << "BtCppClient::tick() " << this->name();
 
-    // get params from external blackboard.
-    // This is inefficient... it'll be better to use internal blackboard in the future.
+    // the action may change what conditions check, results prefetched in this cycle are no more valid
+    BtCppTickBatch::instance().invalidate();
 
-    Optional<std::string> targetName = getInput<std::string>("target");
-    // if we have a target, fetch the corresponding params from blackboard, if any
-    if(targetName)
+    // The tree never waits for the server: the tick is sent in background and the node
+    // stays RUNNING until the reply arrives, then the reply is returned at next tick.
+    if(m_pendingTick.valid())
     {
-        m_params = m_blackBoardClient.getData(targetName.value());
-        yInfo() << "Got data from blackboard " << m_params.toString();
+        if(m_pendingTick.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return NodeStatus::RUNNING;
+
+        yarp::BT_wrappers::ReturnStatus ret = m_pendingTick.get();
+        yInfo() << "after tick() " << this->name();
+        // still running: send the next tick right away instead of at next tree tick
+        if(ret != yarp::BT_wrappers::BT_RUNNING)
+            return toBT_cpp(ret);
     }
 
+    Optional<std::string> targetName = getInput<std::string>("target");
+
     yInfo() << "before tick() " << this->name();
-    yarp::BT_wrappers::ReturnStatus ret = m_tickClient.request_tick(m_targetId, m_params);
-    yInfo() << "after tick() " << this->name();
-    return toBT_cpp(ret);
+    m_pendingTick = m_tickClient.request_tick_async(m_targetId, [this, targetName](std::int64_t &version)
+    {
+        // get params from external blackboard.
+        // This is inefficient... it'll be better to use internal blackboard in the future.
+        // if we have a target, fetch the corresponding params from blackboard, if any.
+        // Not called while the server is running the action, the tick will be answered locally.
+        // Their version lets the tick client send them only when they changed
+        if(targetName)
+        {
+            m_params = m_blackBoardClient.getData(targetName.value(), version);
+            yInfo() << "Got data from blackboard " << m_params.toString();
+        }
+        return m_params;
+    });
+
+    // answered locally
+    if(m_pendingTick.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        return toBT_cpp(m_pendingTick.get());
+
+    return NodeStatus::RUNNING;
 }
 
 
 void BtCppClient::halt()
 {
     yInfo() << "BtCppClient::halt() " << this->name();
-    m_tickClient.request_halt(m_targetId, m_params);
+    BtCppTickBatch::instance().invalidate();
+
+    // The halt is queued after the tick still in flight, if any, so the server receives them in order
+    // and the tree does not wait for either. m_params is read by the thread sending the halt,
+    // once the tick has written it.
+    m_pendingTick = {};
+    m_pendingHalt = m_tickClient.request_halt_async(m_targetId, [this]{ return m_params; });
     yInfo() << "BtCppClient::halt() DONE " << this->name();
     return;
 }
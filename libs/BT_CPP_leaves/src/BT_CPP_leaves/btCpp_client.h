@@ -16,6 +16,7 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <future>
 
 #include "btCpp_common.h"
 
@@ -43,9 +44,15 @@ private:
     yarp::BT_wrappers::TickClient          m_tickClient;
     yarp::BT_wrappers::BlackBoardClient    m_blackBoardClient;
 
+    // tick sent to the server and not answered yet
+    std::future<yarp::BT_wrappers::ReturnStatus> m_pendingTick;
+    // last halt sent to the server, never waited for but on destruction
+    std::future<yarp::BT_wrappers::ReturnStatus> m_pendingHalt;
+
 public:
 
     BtCppClient(const std::string& name, const BT::NodeConfiguration& config);
+    ~BtCppClient();
 
     bool initialize(yarp::os::Searchable &params) override;
     bool terminate() override;
@@ -59,7 +66,8 @@ public:
         return { BT::InputPort("target",    "Name of the target this action is referring to, if any. "
                                             "In case addictional data are required, they will be fetched from blackboard using <target> as key."),
                  BT::InputPort("resources", "List of resources required by this action, if any."),
-                 BT::InputPort("serverPort", "YARP Port Name to connect to.")
+                 BT::InputPort("serverPort", "YARP Port Name to connect to."),
+                 BT::InputPort("timeout",    "Max time in seconds to wait for the reply of the server. Default from engine parameter <rpc_timeout>.")
         };
     }
 private:
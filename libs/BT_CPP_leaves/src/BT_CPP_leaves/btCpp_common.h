@@ -13,8 +13,11 @@
 #ifndef YARP_BT_CPP_COMMON_H
 #define YARP_BT_CPP_COMMON_H
 
+#include <yarp/os/Value.h>
+#include <yarp/os/Searchable.h>
 #include <yarp/BT_wrappers/ReturnStatus.h>
 #include <behaviortree_cpp/basic_types.h>
+#include <behaviortree_cpp/tree_node.h>
 
 namespace bt_cpp_modules {
 
@@ -34,6 +37,16 @@ class iBT_CPP_modules {
     virtual bool terminate() = 0;
 };
 
+// Max time to wait for the reply of a server, in seconds: the <timeout> input port of the node
+// if set in the XML, otherwise the <rpc_timeout> parameter of the engine; 0 waits forever
+static double rpcTimeout(const BT::TreeNode &node, yarp::os::Searchable &params)
+{
+    BT::Optional<double> timeout = node.getInput<double>("timeout");
+    if(timeout)
+        return timeout.value();
+    return params.check("rpc_timeout", yarp::os::Value(0.0)).asDouble();
+}
+
 // Enum conversion function
 static BT::NodeStatus toBT_cpp(yarp::BT_wrappers::ReturnStatus status)
 {
@@ -57,14 +57,12 @@ NodeStatus BtCpp_DummyServer::tick()
 {
     yInfo() << __FUNCTION__ << this->name();
 
-    // get actual params from blackboard. This is done in the tick, so
-    // parameters are always updated in case they changed in the blackboard
-    m_params = m_blackBoardClient.getData(m_targetId.target);
+    // get actual counter from blackboard. This is done in the tick, so
+    // it is always updated in case it changed in the blackboard
+    int currValue = m_blackBoardClient.getField(m_targetId.target, "counter").asInt32();
 
     // Do stuff here ... simply increase the counter and update the blackboard.
-    int currValue = m_params.find("counter").asInt32();
-    m_params.put("counter", ++currValue);
-    m_blackBoardClient.setData(m_targetId.target, m_params);
+    m_blackBoardClient.setField(m_targetId.target, "counter", yarp::os::Value(currValue + 1));
     return BT::NodeStatus::SUCCESS;
 }
 
@@ -12,6 +12,7 @@
  */
 
 #include "btCpp_setCondition.h"
+#include "btCpp_tickBatch.h"
 #include "btCpp_common.h"
 
 #include <memory>
@@ -36,8 +37,6 @@ bool BtCppSetCondition::connect(std::string serverName)
 
 bool BtCppSetCondition::initialize(Searchable &params)
 {
-    YARP_UNUSED(params);
-
     bool ret{false};
     string portPrefix = "/BT_engine/";
     string clientName = this->name() + "/" + std::to_string(UID());
@@ -55,6 +54,7 @@ bool BtCppSetCondition::initialize(Searchable &params)
         yError() << "<serverPort> parameter for node " << this->name() << " is missing";
         return false;
     }
+    m_blackBoardClient.setTimeout(rpcTimeout(*this, params));
     ret &= connect(m_serverPort);
 
     if(!ret)
@@ -77,7 +77,8 @@ bool BtCppSetCondition::initialize(Searchable &params)
         return false;
     }
 
-    initValue(flagName.value());
+    m_flag = flagName.value();
+    initValue(m_flag);
 
     m_target = targetName.value();
     return true;
@@ -99,8 +100,11 @@ bool BtCppSetCondition::terminate()
 //
 NodeStatus BtCppSetCondition::tick()
 {
+    // conditions prefetched in this cycle may check the value being changed
+    BtCppTickBatch::instance().invalidate();
+
     ReturnStatus ret;
-    m_blackBoardClient.setData(m_target, m_value) ? ret = BT_SUCCESS : ret = BT_FAILURE;
+    m_blackBoardClient.setField(m_target, m_flag, m_value.find(m_flag)) ? ret = BT_SUCCESS : ret = BT_FAILURE;
     return toBT_cpp(ret);
 }
 
@@ -119,8 +123,11 @@ BtCppResetCondition::BtCppResetCondition(const string &name, const BT::NodeConfi
 
 NodeStatus BtCppResetCondition::tick()
 {
+    // conditions prefetched in this cycle may check the value being changed
+    BtCppTickBatch::instance().invalidate();
+
     ReturnStatus ret;
-    m_blackBoardClient.setData(m_target, m_value) ? ret = BT_SUCCESS : ret = BT_FAILURE;
+    m_blackBoardClient.setField(m_target, m_flag, m_value.find(m_flag)) ? ret = BT_SUCCESS : ret = BT_FAILURE;
     return toBT_cpp(ret);
 }
 
@@ -38,6 +38,7 @@ class BtCppSetCondition : public BT::ActionNodeBase,          // inherit from Be
 {
 protected:
     std::string         m_target;
+    std::string         m_flag;
     std::string         m_serverPort;
     yarp::os::Property  m_value;
 
@@ -67,7 +68,8 @@ public:
     {
         return { BT::InputPort("target",        "Name of the target the flag is refeered to."),
                  BT::InputPort("flag",          "Property of the target to be set to true."),
-                 BT::InputPort("serverPort",    "YARP Port Name to connect to.")
+                 BT::InputPort("serverPort",    "YARP Port Name to connect to."),
+                 BT::InputPort("timeout",       "Max time in seconds to wait for the reply of the blackboard. Default from engine parameter <rpc_timeout>.")
         };
     }
 
@@ -0,0 +1,110 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file btCpp_tickBatch.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "btCpp_tickBatch.h"
+
+#include <yarp/os/LogStream.h>
+
+using namespace std;
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+using namespace bt_cpp_modules;
+
+BtCppTickBatch& BtCppTickBatch::instance()
+{
+    static BtCppTickBatch batch;
+    return batch;
+}
+
+bool BtCppTickBatch::add(const std::string &serverPort, const ActionID &target, const Property &params, double timeout)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _groups.find(serverPort);
+    if(it == _groups.end())
+    {
+        auto group = std::make_unique<Group>();
+        string clientName = std::to_string(_groups.size());
+        group->timeout = timeout > 0 ? timeout : 0.0;
+        group->client.setTimeout(group->timeout);
+        if(!group->client.configure_TickClient("/BT_engine/batch", clientName) ||
+           !group->client.connect(serverPort))
+        {
+            yError() << "BtCppTickBatch: cannot connect batch client to <" + serverPort + ">";
+            return false;
+        }
+        it = _groups.emplace(serverPort, std::move(group)).first;
+    }
+
+    // the shortest timeout of the conditions in the group
+    Group &group = *it->second;
+    if(timeout > 0 && (group.timeout <= 0 || timeout < group.timeout))
+    {
+        group.timeout = timeout;
+        group.client.setTimeout(timeout);
+    }
+    group.index[target.action_ID] = group.targets.size();
+    group.targets.push_back(target);
+    group.params.push_back(params);
+    group.results.push_back(BT_IDLE);
+    group.fresh.push_back(false);
+    return true;
+}
+
+void BtCppTickBatch::beginCycle()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for(auto &it : _groups)
+    {
+        it.second->fetched = false;
+        it.second->fresh.assign(it.second->fresh.size(), false);
+    }
+}
+
+bool BtCppTickBatch::take(const std::string &serverPort, std::int32_t action_ID, ReturnStatus &status)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _groups.find(serverPort);
+    if(it == _groups.end())
+        return false;
+
+    Group &group = *it->second;
+    auto pos = group.index.find(action_ID);
+    if(pos == group.index.end())
+        return false;
+
+    // first condition of this server reached by the tree in this cycle.
+    // A single condition would cost the same round trip
+    if(!group.fetched && group.targets.size() >= 2)
+    {
+        group.fetched = true;
+        group.results = group.client.request_batch_tick(group.targets, group.params);
+        group.fresh.assign(group.targets.size(), true);
+    }
+
+    if(!group.fresh[pos->second])
+        return false;
+
+    group.fresh[pos->second] = false;
+    status = group.results[pos->second];
+    return true;
+}
+
+void BtCppTickBatch::invalidate()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for(auto &it : _groups)
+        it.second->fresh.assign(it.second->fresh.size(), false);
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file btCpp_tickBatch.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_CPP_TICK_BATCH_H
+#define YARP_BT_CPP_TICK_BATCH_H
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include <yarp/os/Property.h>
+#include <yarp/BT_wrappers/tick_client.h>
+
+namespace bt_cpp_modules {
+
+/**
+ * @brief The BtCppTickBatch class  Collects the condition nodes bound to the same server, so that they can be
+ *                                  ticked with a single `request_batch_tick` message.
+ *
+ * Batching ticks every registered condition of a server, also the ones the tree will not reach in this cycle,
+ * so only conditions whose check has no side effects may register, as opted in by the tree (see BtCppCheckCondition).
+ * The engine calls `beginCycle` before each tick of the tree; the first registered condition the tree ticks on
+ * a server then fetches, with one message, the results of all the conditions registered on that server, and
+ * the others take their result instead of making their own round trip. Servers with a single registered
+ * condition are never batched. Each result can be taken once. Since actions may change what conditions check,
+ * ticking an action calls `invalidate`: conditions ticked after it in the same cycle go back to their own request_tick.
+ */
+class BtCppTickBatch
+{
+public:
+    static BtCppTickBatch& instance();
+
+    /**
+     * @brief add           Register a condition to be ticked in batch.
+     * @param serverPort    the server the condition is bound to, as given to TickClient::connect
+     * @param timeout       max time to wait for the reply of the server, the batch uses the shortest one
+     * @return              false if the batch client for <serverPort> cannot be created
+     */
+    bool add(const std::string &serverPort, const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params,
+             double timeout = 0.0);
+
+    /**
+     * @brief beginCycle    Discard the results of the previous cycle, the next take on each server fetches new ones.
+     */
+    void beginCycle();
+
+    /**
+     * @brief take          Get the result of a registered condition for this cycle, fetching the results of all the
+     *                      conditions registered on <serverPort> at the first call of the cycle.
+     * @return              true if <status> has been filled in, false if the condition has to send its own tick
+     */
+    bool take(const std::string &serverPort, std::int32_t action_ID, yarp::BT_wrappers::ReturnStatus &status);
+
+    /**
+     * @brief invalidate    Discard all results fetched in this cycle.
+     */
+    void invalidate();
+
+private:
+    BtCppTickBatch() = default;
+
+    struct Group
+    {
+        yarp::BT_wrappers::TickClient                   client;
+        std::vector<yarp::BT_wrappers::ActionID>        targets;
+        std::vector<yarp::os::Property>                 params;
+        std::vector<yarp::BT_wrappers::ReturnStatus>    results;
+        std::vector<bool>                               fresh;      // result not taken yet
+        bool                                            fetched {false};    // batch sent in this cycle
+        std::map<std::int32_t, size_t>                  index;      // action_ID -> position
+        double                                          timeout {0.0};
+    };
+
+    std::mutex                                      _mutex;
+    std::map<std::string, std::unique_ptr<Group>>   _groups;
+};
+
+}
+
+#endif // YARP_BT_CPP_TICK_BATCH_H
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_ACTIONSTATUS_H
+#define YARP_THRIFT_GENERATOR_STRUCT_ACTIONSTATUS_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+#include <yarp/BT_wrappers/ReturnStatus.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * The ActionStatus is published by a TickServer on its status:o port whenever
+ * an action executed in threaded mode finishes, so that clients can stop
+ * polling the server while the action is running.
+ * Fields are:
+ * action_ID: the action_ID of the ActionID the status refers to.
+ * status: the value returned by the server's request_tick routine.
+ * seq: sequence number of the message, incremented by the server at each publication.
+ */
+class ActionStatus :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    std::int32_t action_ID;
+    ReturnStatus status;
+    std::int64_t seq;
+
+    // Default constructor
+    ActionStatus();
+
+    // Constructor with field values
+    ActionStatus(const std::int32_t action_ID,
+                 const ReturnStatus status,
+                 const std::int64_t seq);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<ActionStatus> unwrapped;
+
+    class Editor :
+            public yarp::os::Wire,
+            public yarp::os::PortWriter
+    {
+    public:
+        // Editor: default constructor
+        Editor();
+
+        // Editor: constructor with base class
+        Editor(ActionStatus& obj);
+
+        // Editor: destructor
+        ~Editor() override;
+
+        // Editor: Deleted constructors and operator=
+        Editor(const Editor& rhs) = delete;
+        Editor(Editor&& rhs) = delete;
+        Editor& operator=(const Editor& rhs) = delete;
+        Editor& operator=(Editor&& rhs) = delete;
+
+        // Editor: edit
+        bool edit(ActionStatus& obj, bool dirty = true);
+
+        // Editor: validity check
+        bool isValid() const;
+
+        // Editor: state
+        ActionStatus& state();
+
+        // Editor: start editing
+        void start_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use start_editing() instead")
+        void begin()
+        {
+            start_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: stop editing
+        void stop_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use stop_editing() instead")
+        void end()
+        {
+            stop_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: action_ID field
+        void set_action_ID(const std::int32_t action_ID);
+        std::int32_t get_action_ID() const;
+        virtual bool will_set_action_ID();
+        virtual bool did_set_action_ID();
+
+        // Editor: status field
+        void set_status(const ReturnStatus status);
+        ReturnStatus get_status() const;
+        virtual bool will_set_status();
+        virtual bool did_set_status();
+
+        // Editor: seq field
+        void set_seq(const std::int64_t seq);
+        std::int64_t get_seq() const;
+        virtual bool will_set_seq();
+        virtual bool did_set_seq();
+
+        // Editor: clean
+        void clean();
+
+        // Editor: read
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        // Editor: write
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    private:
+        // Editor: state
+        ActionStatus* obj;
+        bool obj_owned;
+        int group;
+
+        // Editor: dirty variables
+        bool is_dirty;
+        bool is_dirty_action_ID;
+        bool is_dirty_status;
+        bool is_dirty_seq;
+        int dirty_count;
+
+        // Editor: send if possible
+        void communicate();
+
+        // Editor: mark dirty overall
+        void mark_dirty();
+
+        // Editor: mark dirty single fields
+        void mark_dirty_action_ID();
+        void mark_dirty_status();
+        void mark_dirty_seq();
+
+        // Editor: dirty_flags
+        void dirty_flags(bool flag);
+    };
+
+private:
+    // read/write action_ID field
+    bool read_action_ID(yarp::os::idl::WireReader& reader);
+    bool write_action_ID(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_action_ID(yarp::os::idl::WireReader& reader);
+    bool nested_write_action_ID(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write status field
+    bool read_status(yarp::os::idl::WireReader& reader);
+    bool write_status(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_status(yarp::os::idl::WireReader& reader);
+    bool nested_write_status(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write seq field
+    bool read_seq(yarp::os::idl::WireReader& reader);
+    bool write_seq(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_seq(yarp::os::idl::WireReader& reader);
+    bool nested_write_seq(const yarp::os::idl::WireWriter& writer) const;
+};
+
+} // namespace yarp
+} // namespace BT_wrappers
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_ACTIONSTATUS_H
@@ -18,6 +18,7 @@
 #include <yarp/os/idl/WireTypes.h>
 #include <yarp/BT_wrappers/ActionID.h>
 #include <yarp/BT_wrappers/ReturnStatus.h>
+#include <yarp/BT_wrappers/TickReply.h>
 #include <yarp/os/Property.h>
 
 namespace yarp {
@@ -64,6 +65,56 @@ public:
      */
     virtual ReturnStatus request_halt(const ActionID& target, const yarp::os::Property& params = {  });
 
+    /**
+     * request_batch_tick  Send the Tick requests of several actions handled by this server in a single message.
+     *                      It is equivalent to calling request_tick for each element of <targets>, in order,
+     *                      but it costs a single round trip.
+     * targets       The actions to tick.
+     * params        The parameters of each action, matched to <targets> by position.
+     *                      If shorter than <targets>, missing entries are empty.
+     * return              The status of each action, in the same order as <targets>.
+     */
+    virtual std::vector<ReturnStatus> request_batch_tick(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params);
+
+    /**
+     * register_target  Bind an ActionID to a compact handle, to be used by the *_handle methods below
+     *                      instead of sending the whole ActionID at every call.
+     *                      Registering again the same ActionID returns the same handle.
+     * target        The ActionID to register.
+     * return              The handle, greater than zero; zero if the server cannot register more targets.
+     */
+    virtual std::int32_t register_target(const ActionID& target);
+
+    /**
+     * tick_handle  Same as request_tick, for the ActionID registered with <handle>.
+     * return              The enum indicating the status of the action; BT_ERROR if the handle is unknown.
+     */
+    virtual ReturnStatus tick_handle(const std::int32_t handle, const yarp::os::Property& params = {  });
+
+    /**
+     * tick_versioned  Same as tick_handle, sending the params only when they change.
+     *                      The server keeps the last params received for each action along with their version,
+     *                      and uses them when the client sends the same version again without params.
+     * handle        The handle of the action, from register_target.
+     * version       The version of the params, e.g. a hash of their content.
+     * with_params   true if <params> are sent, false to use the ones the server already has for <version>.
+     * params        The params of the tick, only if <with_params> is true.
+     * return              The status of the action, or params_needed set if the server does not have <version>.
+     */
+    virtual TickReply tick_versioned(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params = {  });
+
+    /**
+     * halt_handle  Same as request_halt, for the ActionID registered with <handle>.
+     * return              The enum indicating the status of the action; BT_ERROR if the handle is unknown.
+     */
+    virtual ReturnStatus halt_handle(const std::int32_t handle, const yarp::os::Property& params = {  });
+
+    /**
+     * status_handle  Same as request_status, for the ActionID registered with <handle>.
+     * return              The enum indicating the status of the action; BT_ERROR if the handle is unknown.
+     */
+    virtual ReturnStatus status_handle(const std::int32_t handle);
+
     /**
      *  request_initialize  Hook for an initialization callback. The client can ask the action server to perform
      *                      an initialization step.
@@ -77,6 +128,20 @@ public:
      */
     virtual bool request_terminate();
 
+    /**
+     * request_stats  Get the statistics collected by the server since start or last reset:
+     *                      number of ticks and halts, number of replies for each ReturnStatus,
+     *                      and the latency histograms of tick handling, user code and queueing, in microseconds.
+     * return              A Property with one entry for each counter and one group for each histogram.
+     */
+    virtual yarp::os::Property request_stats();
+
+    /**
+     * reset_stats  Clear all the statistics collected by the server.
+     * return              true if the call was successful, false otherwise
+     */
+    virtual bool reset_stats();
+
     // help method
     virtual std::vector<std::string> help(const std::string& functionName = "--all");
 
@@ -16,7 +16,12 @@
 
 #include <yarp/os/Wire.h>
 #include <yarp/os/idl/WireTypes.h>
+#include <yarp/BT_wrappers/SpatialMatch.h>
+#include <yarp/BT_wrappers/TargetPage.h>
+#include <yarp/BT_wrappers/VersionedData.h>
 #include <yarp/os/Property.h>
+#include <yarp/BT_wrappers/property_merge.h>
+#include <yarp/os/Value.h>
 
 namespace yarp {
 namespace BT_wrappers {
@@ -30,7 +35,42 @@ public:
 
     virtual yarp::os::Property getData(const std::string& target);
 
-    virtual bool setData(const std::string& target, const yarp::os::Property& datum);
+    /**
+     * Get the content of <target> only if its version differs from <knownVersion>.
+     * Targets not existing are always reported as changed.
+     */
+    virtual VersionedData getDataIfChanged(const std::string& target, const std::int64_t knownVersion);
+
+    virtual bool setData(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum);
+
+    /**
+     * Merge <datum> into <target> as setData, then drop the whole target <ttl> seconds later.
+     * A <ttl> of zero or less removes the expiration of <target>; setData leaves it as it is.
+     */
+    virtual bool setDataWithTTL(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum, const double ttl);
+
+    /**
+     * Get the value of the field <key> of <target>, a null Value if missing.
+     */
+    virtual yarp::os::Value getField(const std::string& target, const std::string& key);
+
+    /**
+     * Set the field <key> of <target> to <value>, leaving the other fields as they are.
+     */
+    virtual bool setField(const std::string& target, const std::string& key, const yarp::os::Value& value);
+
+    /**
+     * Get the content of several targets at once, in the same order as <targets>.
+     * The contents are read together, so they are consistent with each other.
+     */
+    virtual std::vector<yarp::os::Property> getMany(const std::vector<std::string>& targets);
+
+    /**
+     * Merge data[i] into targets[i], as setData, for all i at once.
+     * The writes are applied together: readers see either none or all of them.
+     * Returns false, without writing anything, if the lists have different sizes.
+     */
+    virtual bool setMany(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data);
 
     virtual void clearData(const std::string& target);
 
@@ -40,6 +80,51 @@ public:
 
     virtual std::vector<std::string> listTarget();
 
+    /**
+     * The targets starting with <prefix>, in alphabetical order, at most <limit> at a time (all if zero or less).
+     * <cursor> is empty for the first page, then the cursor of the previous page.
+     */
+    virtual TargetPage listTargets(const std::string& prefix, const std::int32_t limit, const std::string& cursor);
+
+    /**
+     * As listTargets, also returning the content of each target.
+     */
+    virtual TargetPage scan(const std::string& prefix, const std::int32_t limit, const std::string& cursor);
+
+    /**
+     * Memory used by the blackboard, as (entries N) (bytes N) (max_bytes N) (evictions N) (expirations N).
+     * max_bytes is 0 if there is no memory budget. bytes is an estimate, computed from the structure of the
+     * values of the targets not in the initial values.
+     */
+    virtual yarp::os::Property getMemoryStats();
+
+    /**
+     * Targets with a position on map <mapId> within <radius> of (x, y, z), the nearest first.
+     * A target has a position if it contains either (pose (x y z)), with an optional (map_id name),
+     * or (location (map_id name) (x x) (y y)), with an optional (z z). Positions without a map_id
+     * are on map "".
+     */
+    virtual std::vector<SpatialMatch> findInRadius(const std::string& mapId, const double x, const double y, const double z, const double radius);
+
+    /**
+     * The <count> targets with a position on map <mapId> nearest to (x, y, z), the nearest first.
+     */
+    virtual std::vector<SpatialMatch> findNearest(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count);
+
+    /**
+     * Publish the changes of the targets matching <pattern> on the updates:o port, for <subscriber>,
+     * i.e. the name of the port it connected to updates:o.
+     * <pattern> is either a target name or a prefix followed by '*'. Watching it again from the same
+     * subscriber has no effect. The current content of the matching targets is published right away.
+     */
+    virtual bool watch(const std::string& pattern, const std::string& subscriber);
+
+    /**
+     * Stop watching <pattern> for <subscriber>. The changes keep being published while other
+     * subscribers watch it, or the same subscriber through another pattern.
+     */
+    virtual bool unwatch(const std::string& pattern, const std::string& subscriber);
+
     // help method
     virtual std::vector<std::string> help(const std::string& functionName = "--all");
 
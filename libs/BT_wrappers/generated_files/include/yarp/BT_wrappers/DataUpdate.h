@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_DATAUPDATE_H
+#define YARP_THRIFT_GENERATOR_STRUCT_DATAUPDATE_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * The DataUpdate is published by the blackboard on its updates:o port whenever
+ * a watched target is modified, see watch().
+ * Fields are:
+ * target: the target modified.
+ * version: increased at each modification of the blackboard, a newer update has a greater version.
+ * reset: if true, the previous content of the target is dropped before applying delta,
+ *        e.g. when the target has been cleared or reset. Otherwise delta is merged as in setData.
+ * delta: the data changed.
+ */
+class DataUpdate :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    std::string target;
+    std::int64_t version;
+    bool reset;
+    yarp::os::Property delta;
+
+    // Default constructor
+    DataUpdate();
+
+    // Constructor with field values
+    DataUpdate(const std::string& target,
+               const std::int64_t version,
+               const bool reset,
+               const yarp::os::Property& delta);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<DataUpdate> unwrapped;
+
+    class Editor :
+            public yarp::os::Wire,
+            public yarp::os::PortWriter
+    {
+    public:
+        // Editor: default constructor
+        Editor();
+
+        // Editor: constructor with base class
+        Editor(DataUpdate& obj);
+
+        // Editor: destructor
+        ~Editor() override;
+
+        // Editor: Deleted constructors and operator=
+        Editor(const Editor& rhs) = delete;
+        Editor(Editor&& rhs) = delete;
+        Editor& operator=(const Editor& rhs) = delete;
+        Editor& operator=(Editor&& rhs) = delete;
+
+        // Editor: edit
+        bool edit(DataUpdate& obj, bool dirty = true);
+
+        // Editor: validity check
+        bool isValid() const;
+
+        // Editor: state
+        DataUpdate& state();
+
+        // Editor: start editing
+        void start_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use start_editing() instead")
+        void begin()
+        {
+            start_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: stop editing
+        void stop_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use stop_editing() instead")
+        void end()
+        {
+            stop_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: target field
+        void set_target(const std::string& target);
+        const std::string& get_target() const;
+        virtual bool will_set_target();
+        virtual bool did_set_target();
+
+        // Editor: version field
+        void set_version(const std::int64_t version);
+        std::int64_t get_version() const;
+        virtual bool will_set_version();
+        virtual bool did_set_version();
+
+        // Editor: reset field
+        void set_reset(const bool reset);
+        bool get_reset() const;
+        virtual bool will_set_reset();
+        virtual bool did_set_reset();
+
+        // Editor: delta field
+        void set_delta(const yarp::os::Property& delta);
+        const yarp::os::Property& get_delta() const;
+        virtual bool will_set_delta();
+        virtual bool did_set_delta();
+
+        // Editor: clean
+        void clean();
+
+        // Editor: read
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        // Editor: write
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    private:
+        // Editor: state
+        DataUpdate* obj;
+        bool obj_owned;
+        int group;
+
+        // Editor: dirty variables
+        bool is_dirty;
+        bool is_dirty_target;
+        bool is_dirty_version;
+        bool is_dirty_reset;
+        bool is_dirty_delta;
+        int dirty_count;
+
+        // Editor: send if possible
+        void communicate();
+
+        // Editor: mark dirty overall
+        void mark_dirty();
+
+        // Editor: mark dirty single fields
+        void mark_dirty_target();
+        void mark_dirty_version();
+        void mark_dirty_reset();
+        void mark_dirty_delta();
+
+        // Editor: dirty_flags
+        void dirty_flags(bool flag);
+    };
+
+private:
+    // read/write target field
+    bool read_target(yarp::os::idl::WireReader& reader);
+    bool write_target(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_target(yarp::os::idl::WireReader& reader);
+    bool nested_write_target(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write version field
+    bool read_version(yarp::os::idl::WireReader& reader);
+    bool write_version(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_version(yarp::os::idl::WireReader& reader);
+    bool nested_write_version(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write reset field
+    bool read_reset(yarp::os::idl::WireReader& reader);
+    bool write_reset(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_reset(yarp::os::idl::WireReader& reader);
+    bool nested_write_reset(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write delta field
+    bool read_delta(yarp::os::idl::WireReader& reader);
+    bool write_delta(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_delta(yarp::os::idl::WireReader& reader);
+    bool nested_write_delta(const yarp::os::idl::WireWriter& writer) const;
+};
+
+} // namespace yarp
+} // namespace BT_wrappers
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_DATAUPDATE_H
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_SPATIALMATCH_H
+#define YARP_THRIFT_GENERATOR_STRUCT_SPATIALMATCH_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * The SpatialMatch is returned by the spatial queries, findInRadius and findNearest.
+ * Fields are:
+ * target: the target found.
+ * distance: distance of its position from the point asked for.
+ * data: the content of the target.
+ */
+class SpatialMatch :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    std::string target;
+    double distance;
+    yarp::os::Property data;
+
+    // Default constructor
+    SpatialMatch();
+
+    // Constructor with field values
+    SpatialMatch(const std::string& target,
+                 const double distance,
+                 const yarp::os::Property& data);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<SpatialMatch> unwrapped;
+
+    class Editor :
+            public yarp::os::Wire,
+            public yarp::os::PortWriter
+    {
+    public:
+        // Editor: default constructor
+        Editor();
+
+        // Editor: constructor with base class
+        Editor(SpatialMatch& obj);
+
+        // Editor: destructor
+        ~Editor() override;
+
+        // Editor: Deleted constructors and operator=
+        Editor(const Editor& rhs) = delete;
+        Editor(Editor&& rhs) = delete;
+        Editor& operator=(const Editor& rhs) = delete;
+        Editor& operator=(Editor&& rhs) = delete;
+
+        // Editor: edit
+        bool edit(SpatialMatch& obj, bool dirty = true);
+
+        // Editor: validity check
+        bool isValid() const;
+
+        // Editor: state
+        SpatialMatch& state();
+
+        // Editor: start editing
+        void start_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use start_editing() instead")
+        void begin()
+        {
+            start_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: stop editing
+        void stop_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use stop_editing() instead")
+        void end()
+        {
+            stop_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: target field
+        void set_target(const std::string& target);
+        const std::string& get_target() const;
+        virtual bool will_set_target();
+        virtual bool did_set_target();
+
+        // Editor: distance field
+        void set_distance(const double distance);
+        double get_distance() const;
+        virtual bool will_set_distance();
+        virtual bool did_set_distance();
+
+        // Editor: data field
+        void set_data(const yarp::os::Property& data);
+        const yarp::os::Property& get_data() const;
+        virtual bool will_set_data();
+        virtual bool did_set_data();
+
+        // Editor: clean
+        void clean();
+
+        // Editor: read
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        // Editor: write
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    private:
+        // Editor: state
+        SpatialMatch* obj;
+        bool obj_owned;
+        int group;
+
+        // Editor: dirty variables
+        bool is_dirty;
+        bool is_dirty_target;
+        bool is_dirty_distance;
+        bool is_dirty_data;
+        int dirty_count;
+
+        // Editor: send if possible
+        void communicate();
+
+        // Editor: mark dirty overall
+        void mark_dirty();
+
+        // Editor: mark dirty single fields
+        void mark_dirty_target();
+        void mark_dirty_distance();
+        void mark_dirty_data();
+
+        // Editor: dirty_flags
+        void dirty_flags(bool flag);
+    };
+
+private:
+    // read/write target field
+    bool read_target(yarp::os::idl::WireReader& reader);
+    bool write_target(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_target(yarp::os::idl::WireReader& reader);
+    bool nested_write_target(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write distance field
+    bool read_distance(yarp::os::idl::WireReader& reader);
+    bool write_distance(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_distance(yarp::os::idl::WireReader& reader);
+    bool nested_write_distance(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write data field
+    bool read_data(yarp::os::idl::WireReader& reader);
+    bool write_data(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_data(yarp::os::idl::WireReader& reader);
+    bool nested_write_data(const yarp::os::idl::WireWriter& writer) const;
+};
+
+} // namespace yarp
+} // namespace BT_wrappers
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_SPATIALMATCH_H
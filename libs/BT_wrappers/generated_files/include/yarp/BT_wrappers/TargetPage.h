@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_TARGETPAGE_H
+#define YARP_THRIFT_GENERATOR_STRUCT_TARGETPAGE_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * The TargetPage is a page of the targets returned by listTargets and scan, in alphabetical order.
+ * Fields are:
+ * targets: the targets of this page.
+ * data: the content of each target, only for scan.
+ * cursor: to be passed to the following call to get the next page, empty if this is the last one.
+ */
+class TargetPage :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    std::vector<std::string> targets;
+    std::vector<yarp::os::Property> data;
+    std::string cursor;
+
+    // Default constructor
+    TargetPage();
+
+    // Constructor with field values
+    TargetPage(const std::vector<std::string>& targets,
+               const std::vector<yarp::os::Property>& data,
+               const std::string& cursor);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<TargetPage> unwrapped;
+
+    class Editor :
+            public yarp::os::Wire,
+            public yarp::os::PortWriter
+    {
+    public:
+        // Editor: default constructor
+        Editor();
+
+        // Editor: constructor with base class
+        Editor(TargetPage& obj);
+
+        // Editor: destructor
+        ~Editor() override;
+
+        // Editor: Deleted constructors and operator=
+        Editor(const Editor& rhs) = delete;
+        Editor(Editor&& rhs) = delete;
+        Editor& operator=(const Editor& rhs) = delete;
+        Editor& operator=(Editor&& rhs) = delete;
+
+        // Editor: edit
+        bool edit(TargetPage& obj, bool dirty = true);
+
+        // Editor: validity check
+        bool isValid() const;
+
+        // Editor: state
+        TargetPage& state();
+
+        // Editor: start editing
+        void start_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use start_editing() instead")
+        void begin()
+        {
+            start_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: stop editing
+        void stop_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use stop_editing() instead")
+        void end()
+        {
+            stop_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: targets field
+        void set_targets(const std::vector<std::string>& targets);
+        const std::vector<std::string>& get_targets() const;
+        virtual bool will_set_targets();
+        virtual bool did_set_targets();
+
+        // Editor: data field
+        void set_data(const std::vector<yarp::os::Property>& data);
+        const std::vector<yarp::os::Property>& get_data() const;
+        virtual bool will_set_data();
+        virtual bool did_set_data();
+
+        // Editor: cursor field
+        void set_cursor(const std::string& cursor);
+        const std::string& get_cursor() const;
+        virtual bool will_set_cursor();
+        virtual bool did_set_cursor();
+
+        // Editor: clean
+        void clean();
+
+        // Editor: read
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        // Editor: write
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    private:
+        // Editor: state
+        TargetPage* obj;
+        bool obj_owned;
+        int group;
+
+        // Editor: dirty variables
+        bool is_dirty;
+        bool is_dirty_targets;
+        bool is_dirty_data;
+        bool is_dirty_cursor;
+        int dirty_count;
+
+        // Editor: send if possible
+        void communicate();
+
+        // Editor: mark dirty overall
+        void mark_dirty();
+
+        // Editor: mark dirty single fields
+        void mark_dirty_targets();
+        void mark_dirty_data();
+        void mark_dirty_cursor();
+
+        // Editor: dirty_flags
+        void dirty_flags(bool flag);
+    };
+
+private:
+    // read/write targets field
+    bool read_targets(yarp::os::idl::WireReader& reader);
+    bool write_targets(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_targets(yarp::os::idl::WireReader& reader);
+    bool nested_write_targets(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write data field
+    bool read_data(yarp::os::idl::WireReader& reader);
+    bool write_data(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_data(yarp::os::idl::WireReader& reader);
+    bool nested_write_data(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write cursor field
+    bool read_cursor(yarp::os::idl::WireReader& reader);
+    bool write_cursor(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_cursor(yarp::os::idl::WireReader& reader);
+    bool nested_write_cursor(const yarp::os::idl::WireWriter& writer) const;
+};
+
+} // namespace yarp
+} // namespace BT_wrappers
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_TARGETPAGE_H
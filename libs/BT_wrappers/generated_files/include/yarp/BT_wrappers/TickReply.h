@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_TICKREPLY_H
+#define YARP_THRIFT_GENERATOR_STRUCT_TICKREPLY_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+#include <yarp/BT_wrappers/ReturnStatus.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * The TickReply is returned by tick_versioned.
+ * Fields are:
+ * status: the status of the action, as returned by request_tick.
+ * params_needed: true if the server does not have the params with the version sent by the client,
+ *         so the action was not ticked and the client must send the tick again with the params.
+ */
+class TickReply :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    ReturnStatus status;
+    bool params_needed;
+
+    // Default constructor
+    TickReply();
+
+    // Constructor with field values
+    TickReply(const ReturnStatus status,
+              const bool params_needed);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<TickReply> unwrapped;
+
+    class Editor :
+            public yarp::os::Wire,
+            public yarp::os::PortWriter
+    {
+    public:
+        // Editor: default constructor
+        Editor();
+
+        // Editor: constructor with base class
+        Editor(TickReply& obj);
+
+        // Editor: destructor
+        ~Editor() override;
+
+        // Editor: Deleted constructors and operator=
+        Editor(const Editor& rhs) = delete;
+        Editor(Editor&& rhs) = delete;
+        Editor& operator=(const Editor& rhs) = delete;
+        Editor& operator=(Editor&& rhs) = delete;
+
+        // Editor: edit
+        bool edit(TickReply& obj, bool dirty = true);
+
+        // Editor: validity check
+        bool isValid() const;
+
+        // Editor: state
+        TickReply& state();
+
+        // Editor: start editing
+        void start_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use start_editing() instead")
+        void begin()
+        {
+            start_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: stop editing
+        void stop_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use stop_editing() instead")
+        void end()
+        {
+            stop_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: status field
+        void set_status(const ReturnStatus status);
+        ReturnStatus get_status() const;
+        virtual bool will_set_status();
+        virtual bool did_set_status();
+
+        // Editor: params_needed field
+        void set_params_needed(const bool params_needed);
+        bool get_params_needed() const;
+        virtual bool will_set_params_needed();
+        virtual bool did_set_params_needed();
+
+        // Editor: clean
+        void clean();
+
+        // Editor: read
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        // Editor: write
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    private:
+        // Editor: state
+        TickReply* obj;
+        bool obj_owned;
+        int group;
+
+        // Editor: dirty variables
+        bool is_dirty;
+        bool is_dirty_status;
+        bool is_dirty_params_needed;
+        int dirty_count;
+
+        // Editor: send if possible
+        void communicate();
+
+        // Editor: mark dirty overall
+        void mark_dirty();
+
+        // Editor: mark dirty single fields
+        void mark_dirty_status();
+        void mark_dirty_params_needed();
+
+        // Editor: dirty_flags
+        void dirty_flags(bool flag);
+    };
+
+private:
+    // read/write status field
+    bool read_status(yarp::os::idl::WireReader& reader);
+    bool write_status(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_status(yarp::os::idl::WireReader& reader);
+    bool nested_write_status(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write params_needed field
+    bool read_params_needed(yarp::os::idl::WireReader& reader);
+    bool write_params_needed(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_params_needed(yarp::os::idl::WireReader& reader);
+    bool nested_write_params_needed(const yarp::os::idl::WireWriter& writer) const;
+};
+
+} // namespace yarp
+} // namespace BT_wrappers
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_TICKREPLY_H
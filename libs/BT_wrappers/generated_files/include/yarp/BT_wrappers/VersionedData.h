@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_VERSIONEDDATA_H
+#define YARP_THRIFT_GENERATOR_STRUCT_VERSIONEDDATA_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * The VersionedData is returned by getDataIfChanged.
+ * Fields are:
+ * version: version of the target, i.e. of its last modification. 0 if the target does not exist.
+ * changed: false if the target still has the version known by the caller, data is empty then.
+ * data: the content of the target, if changed.
+ */
+class VersionedData :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    std::int64_t version;
+    bool changed;
+    yarp::os::Property data;
+
+    // Default constructor
+    VersionedData();
+
+    // Constructor with field values
+    VersionedData(const std::int64_t version,
+                  const bool changed,
+                  const yarp::os::Property& data);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<VersionedData> unwrapped;
+
+    class Editor :
+            public yarp::os::Wire,
+            public yarp::os::PortWriter
+    {
+    public:
+        // Editor: default constructor
+        Editor();
+
+        // Editor: constructor with base class
+        Editor(VersionedData& obj);
+
+        // Editor: destructor
+        ~Editor() override;
+
+        // Editor: Deleted constructors and operator=
+        Editor(const Editor& rhs) = delete;
+        Editor(Editor&& rhs) = delete;
+        Editor& operator=(const Editor& rhs) = delete;
+        Editor& operator=(Editor&& rhs) = delete;
+
+        // Editor: edit
+        bool edit(VersionedData& obj, bool dirty = true);
+
+        // Editor: validity check
+        bool isValid() const;
+
+        // Editor: state
+        VersionedData& state();
+
+        // Editor: start editing
+        void start_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use start_editing() instead")
+        void begin()
+        {
+            start_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: stop editing
+        void stop_editing();
+
+#ifndef YARP_NO_DEPRECATED // Since YARP 3.2
+        YARP_DEPRECATED_MSG("Use stop_editing() instead")
+        void end()
+        {
+            stop_editing();
+        }
+#endif // YARP_NO_DEPRECATED
+
+        // Editor: version field
+        void set_version(const std::int64_t version);
+        std::int64_t get_version() const;
+        virtual bool will_set_version();
+        virtual bool did_set_version();
+
+        // Editor: changed field
+        void set_changed(const bool changed);
+        bool get_changed() const;
+        virtual bool will_set_changed();
+        virtual bool did_set_changed();
+
+        // Editor: data field
+        void set_data(const yarp::os::Property& data);
+        const yarp::os::Property& get_data() const;
+        virtual bool will_set_data();
+        virtual bool did_set_data();
+
+        // Editor: clean
+        void clean();
+
+        // Editor: read
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        // Editor: write
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    private:
+        // Editor: state
+        VersionedData* obj;
+        bool obj_owned;
+        int group;
+
+        // Editor: dirty variables
+        bool is_dirty;
+        bool is_dirty_version;
+        bool is_dirty_changed;
+        bool is_dirty_data;
+        int dirty_count;
+
+        // Editor: send if possible
+        void communicate();
+
+        // Editor: mark dirty overall
+        void mark_dirty();
+
+        // Editor: mark dirty single fields
+        void mark_dirty_version();
+        void mark_dirty_changed();
+        void mark_dirty_data();
+
+        // Editor: dirty_flags
+        void dirty_flags(bool flag);
+    };
+
+private:
+    // read/write version field
+    bool read_version(yarp::os::idl::WireReader& reader);
+    bool write_version(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_version(yarp::os::idl::WireReader& reader);
+    bool nested_write_version(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write changed field
+    bool read_changed(yarp::os::idl::WireReader& reader);
+    bool write_changed(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_changed(yarp::os::idl::WireReader& reader);
+    bool nested_write_changed(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write data field
+    bool read_data(yarp::os::idl::WireReader& reader);
+    bool write_data(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_data(yarp::os::idl::WireReader& reader);
+    bool nested_write_data(const yarp::os::idl::WireWriter& writer) const;
+};
+
+} // namespace yarp
+} // namespace BT_wrappers
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_VERSIONEDDATA_H
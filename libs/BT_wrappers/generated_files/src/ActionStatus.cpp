@@ -0,0 +1,627 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <yarp/BT_wrappers/ActionStatus.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Default constructor
+ActionStatus::ActionStatus() :
+        WirePortable(),
+        action_ID(0),
+        status((ReturnStatus)0),
+        seq(0)
+{
+}
+
+// Constructor with field values
+ActionStatus::ActionStatus(const std::int32_t action_ID,
+                           const ReturnStatus status,
+                           const std::int64_t seq) :
+        WirePortable(),
+        action_ID(action_ID),
+        status(status),
+        seq(seq)
+{
+}
+
+// Read structure on a Wire
+bool ActionStatus::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_action_ID(reader)) {
+        return false;
+    }
+    if (!read_status(reader)) {
+        return false;
+    }
+    if (!read_seq(reader)) {
+        return false;
+    }
+    return !reader.isError();
+}
+
+// Read structure on a Connection
+bool ActionStatus::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(3)) {
+        return false;
+    }
+    return read(reader);
+}
+
+// Write structure on a Wire
+bool ActionStatus::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_action_ID(writer)) {
+        return false;
+    }
+    if (!write_status(writer)) {
+        return false;
+    }
+    if (!write_seq(writer)) {
+        return false;
+    }
+    return !writer.isError();
+}
+
+// Write structure on a Connection
+bool ActionStatus::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    return write(writer);
+}
+
+// Convert to a printable string
+std::string ActionStatus::toString() const
+{
+    yarp::os::Bottle b;
+    b.read(*this);
+    return b.toString();
+}
+
+// Editor: default constructor
+ActionStatus::Editor::Editor()
+{
+    group = 0;
+    obj_owned = true;
+    obj = new ActionStatus;
+    dirty_flags(false);
+    yarp().setOwner(*this);
+}
+
+// Editor: constructor with base class
+ActionStatus::Editor::Editor(ActionStatus& obj)
+{
+    group = 0;
+    obj_owned = false;
+    edit(obj, false);
+    yarp().setOwner(*this);
+}
+
+// Editor: destructor
+ActionStatus::Editor::~Editor()
+{
+    if (obj_owned) {
+        delete obj;
+    }
+}
+
+// Editor: edit
+bool ActionStatus::Editor::edit(ActionStatus& obj, bool dirty)
+{
+    if (obj_owned) {
+        delete this->obj;
+    }
+    this->obj = &obj;
+    obj_owned = false;
+    dirty_flags(dirty);
+    return true;
+}
+
+// Editor: validity check
+bool ActionStatus::Editor::isValid() const
+{
+    return obj != nullptr;
+}
+
+// Editor: state
+ActionStatus& ActionStatus::Editor::state()
+{
+    return *obj;
+}
+
+// Editor: grouping begin
+void ActionStatus::Editor::start_editing()
+{
+    group++;
+}
+
+// Editor: grouping end
+void ActionStatus::Editor::stop_editing()
+{
+    group--;
+    if (group == 0 && is_dirty) {
+        communicate();
+    }
+}
+// Editor: action_ID setter
+void ActionStatus::Editor::set_action_ID(const std::int32_t action_ID)
+{
+    will_set_action_ID();
+    obj->action_ID = action_ID;
+    mark_dirty_action_ID();
+    communicate();
+    did_set_action_ID();
+}
+
+// Editor: action_ID getter
+std::int32_t ActionStatus::Editor::get_action_ID() const
+{
+    return obj->action_ID;
+}
+
+// Editor: action_ID will_set
+bool ActionStatus::Editor::will_set_action_ID()
+{
+    return true;
+}
+
+// Editor: action_ID did_set
+bool ActionStatus::Editor::did_set_action_ID()
+{
+    return true;
+}
+
+// Editor: status setter
+void ActionStatus::Editor::set_status(const ReturnStatus status)
+{
+    will_set_status();
+    obj->status = status;
+    mark_dirty_status();
+    communicate();
+    did_set_status();
+}
+
+// Editor: status getter
+ReturnStatus ActionStatus::Editor::get_status() const
+{
+    return obj->status;
+}
+
+// Editor: status will_set
+bool ActionStatus::Editor::will_set_status()
+{
+    return true;
+}
+
+// Editor: status did_set
+bool ActionStatus::Editor::did_set_status()
+{
+    return true;
+}
+
+// Editor: seq setter
+void ActionStatus::Editor::set_seq(const std::int64_t seq)
+{
+    will_set_seq();
+    obj->seq = seq;
+    mark_dirty_seq();
+    communicate();
+    did_set_seq();
+}
+
+// Editor: seq getter
+std::int64_t ActionStatus::Editor::get_seq() const
+{
+    return obj->seq;
+}
+
+// Editor: seq will_set
+bool ActionStatus::Editor::will_set_seq()
+{
+    return true;
+}
+
+// Editor: seq did_set
+bool ActionStatus::Editor::did_set_seq()
+{
+    return true;
+}
+
+// Editor: clean
+void ActionStatus::Editor::clean()
+{
+    dirty_flags(false);
+}
+
+// Editor: read
+bool ActionStatus::Editor::read(yarp::os::ConnectionReader& connection)
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireReader reader(connection);
+    reader.expectAccept();
+    if (!reader.readListHeader()) {
+        return false;
+    }
+    int len = reader.getLength();
+    if (len == 0) {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(1)) {
+            return false;
+        }
+        writer.writeString("send: 'help' or 'patch (param1 val1) (param2 val2)'");
+        return true;
+    }
+    std::string tag;
+    if (!reader.readString(tag)) {
+        return false;
+    }
+    if (tag == "help") {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(2)) {
+            return false;
+        }
+        if (!writer.writeTag("many", 1, 0)) {
+            return false;
+        }
+        if (reader.getLength() > 0) {
+            std::string field;
+            if (!reader.readString(field)) {
+                return false;
+            }
+            if (field == "action_ID") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::int32_t action_ID")) {
+                    return false;
+                }
+            }
+            if (field == "status") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("ReturnStatus status")) {
+                    return false;
+                }
+            }
+            if (field == "seq") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::int64_t seq")) {
+                    return false;
+                }
+            }
+        }
+        if (!writer.writeListHeader(4)) {
+            return false;
+        }
+        writer.writeString("*** Available fields:");
+        writer.writeString("action_ID");
+        writer.writeString("status");
+        writer.writeString("seq");
+        return true;
+    }
+    bool nested = true;
+    bool have_act = false;
+    if (tag != "patch") {
+        if (((len - 1) % 2) != 0) {
+            return false;
+        }
+        len = 1 + ((len - 1) / 2);
+        nested = false;
+        have_act = true;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (nested && !reader.readListHeader(3)) {
+            return false;
+        }
+        std::string act;
+        std::string key;
+        if (have_act) {
+            act = tag;
+        } else if (!reader.readString(act)) {
+            return false;
+        }
+        if (!reader.readString(key)) {
+            return false;
+        }
+        if (key == "action_ID") {
+            will_set_action_ID();
+            if (!obj->nested_read_action_ID(reader)) {
+                return false;
+            }
+            did_set_action_ID();
+        } else if (key == "status") {
+            will_set_status();
+            if (!obj->nested_read_status(reader)) {
+                return false;
+            }
+            did_set_status();
+        } else if (key == "seq") {
+            will_set_seq();
+            if (!obj->nested_read_seq(reader)) {
+                return false;
+            }
+            did_set_seq();
+        } else {
+            // would be useful to have a fallback here
+        }
+    }
+    reader.accept();
+    yarp::os::idl::WireWriter writer(reader);
+    if (writer.isNull()) {
+        return true;
+    }
+    writer.writeListHeader(1);
+    writer.writeVocab(yarp::os::createVocab('o', 'k'));
+    return true;
+}
+
+// Editor: write
+bool ActionStatus::Editor::write(yarp::os::ConnectionWriter& connection) const
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(dirty_count + 1)) {
+        return false;
+    }
+    if (!writer.writeString("patch")) {
+        return false;
+    }
+    if (is_dirty_action_ID) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("action_ID")) {
+            return false;
+        }
+        if (!obj->nested_write_action_ID(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_status) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("status")) {
+            return false;
+        }
+        if (!obj->nested_write_status(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_seq) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("seq")) {
+            return false;
+        }
+        if (!obj->nested_write_seq(writer)) {
+            return false;
+        }
+    }
+    return !writer.isError();
+}
+
+// Editor: send if possible
+void ActionStatus::Editor::communicate()
+{
+    if (group != 0) {
+        return;
+    }
+    if (yarp().canWrite()) {
+        yarp().write(*this);
+        clean();
+    }
+}
+
+// Editor: mark dirty overall
+void ActionStatus::Editor::mark_dirty()
+{
+    is_dirty = true;
+}
+
+// Editor: action_ID mark_dirty
+void ActionStatus::Editor::mark_dirty_action_ID()
+{
+    if (is_dirty_action_ID) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_action_ID = true;
+    mark_dirty();
+}
+
+// Editor: status mark_dirty
+void ActionStatus::Editor::mark_dirty_status()
+{
+    if (is_dirty_status) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_status = true;
+    mark_dirty();
+}
+
+// Editor: seq mark_dirty
+void ActionStatus::Editor::mark_dirty_seq()
+{
+    if (is_dirty_seq) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_seq = true;
+    mark_dirty();
+}
+
+// Editor: dirty_flags
+void ActionStatus::Editor::dirty_flags(bool flag)
+{
+    is_dirty = flag;
+    is_dirty_action_ID = flag;
+    is_dirty_status = flag;
+    is_dirty_seq = flag;
+    dirty_count = flag ? 3 : 0;
+}
+
+// read action_ID field
+bool ActionStatus::read_action_ID(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI32(action_ID)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write action_ID field
+bool ActionStatus::write_action_ID(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(action_ID)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) action_ID field
+bool ActionStatus::nested_read_action_ID(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI32(action_ID)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) action_ID field
+bool ActionStatus::nested_write_action_ID(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(action_ID)) {
+        return false;
+    }
+    return true;
+}
+
+// read status field
+bool ActionStatus::read_status(yarp::os::idl::WireReader& reader)
+{
+    int32_t ecast0;
+    ReturnStatusVocab cvrt1;
+    if (!reader.readEnum(ecast0, cvrt1)) {
+        reader.fail();
+        return false;
+    } else {
+        status = static_cast<ReturnStatus>(ecast0);
+    }
+    return true;
+}
+
+// write status field
+bool ActionStatus::write_status(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(static_cast<int32_t>(status))) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) status field
+bool ActionStatus::nested_read_status(yarp::os::idl::WireReader& reader)
+{
+    int32_t ecast2;
+    ReturnStatusVocab cvrt3;
+    if (!reader.readEnum(ecast2, cvrt3)) {
+        reader.fail();
+        return false;
+    } else {
+        status = static_cast<ReturnStatus>(ecast2);
+    }
+    return true;
+}
+
+// write (nested) status field
+bool ActionStatus::nested_write_status(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(static_cast<int32_t>(status))) {
+        return false;
+    }
+    return true;
+}
+
+// read seq field
+bool ActionStatus::read_seq(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI64(seq)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write seq field
+bool ActionStatus::write_seq(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(seq)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) seq field
+bool ActionStatus::nested_read_seq(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI64(seq)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) seq field
+bool ActionStatus::nested_write_seq(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(seq)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace yarp
+} // namespace BT_wrappers
@@ -187,37 +187,442 @@ bool BT_request_request_halt_helper::read(yarp::os::ConnectionReader& connection
     return true;
 }
 
+class BT_request_request_batch_tick_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_request_batch_tick_helper(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::vector<ActionID> m_targets;
+    std::vector<yarp::os::Property> m_params;
+
+    thread_local static std::vector<ReturnStatus> s_return_helper;
+};
+
+thread_local std::vector<ReturnStatus> BT_request_request_batch_tick_helper::s_return_helper = {};
+
+BT_request_request_batch_tick_helper::BT_request_request_batch_tick_helper(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params) :
+        m_targets{targets},
+        m_params{params}
+{
+}
+
+bool BT_request_request_batch_tick_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(5)) {
+        return false;
+    }
+    if (!writer.writeTag("request_batch_tick", 1, 3)) {
+        return false;
+    }
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(m_targets.size()))) {
+        return false;
+    }
+    for (const auto& _item6 : m_targets) {
+        if (!writer.writeNested(_item6)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(m_params.size()))) {
+        return false;
+    }
+    for (const auto& _item7 : m_params) {
+        if (!writer.writeNested(_item7)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_request_batch_tick_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    s_return_helper.clear();
+    uint32_t _size8;
+    yarp::os::idl::WireState _etype11;
+    reader.readListBegin(_etype11, _size8);
+    s_return_helper.resize(_size8);
+    for (auto& _elem12 : s_return_helper) {
+        int32_t ecast13;
+        ReturnStatusVocab cvrt14;
+        if (!reader.readEnum(ecast13, cvrt14)) {
+            reader.fail();
+            return false;
+        } else {
+            _elem12 = static_cast<ReturnStatus>(ecast13);
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+class BT_request_register_target_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_register_target_helper(const ActionID& target);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    ActionID m_target;
+
+    thread_local static std::int32_t s_return_helper;
+};
+
+thread_local std::int32_t BT_request_register_target_helper::s_return_helper = {};
+
+BT_request_register_target_helper::BT_request_register_target_helper(const ActionID& target) :
+        m_target{target}
+{
+    s_return_helper = {};
+}
+
+bool BT_request_register_target_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(5)) {
+        return false;
+    }
+    if (!writer.writeTag("register_target", 1, 2)) {
+        return false;
+    }
+    if (!writer.write(m_target)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_register_target_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.readI32(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BT_request_tick_handle_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_tick_handle_helper(const std::int32_t handle, const yarp::os::Property& params);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::int32_t m_handle;
+    yarp::os::Property m_params;
+
+    thread_local static ReturnStatus s_return_helper;
+};
+
+thread_local ReturnStatus BT_request_tick_handle_helper::s_return_helper = {};
+
+BT_request_tick_handle_helper::BT_request_tick_handle_helper(const std::int32_t handle, const yarp::os::Property& params) :
+        m_handle{handle},
+        m_params{params}
+{
+    s_return_helper = {};
+}
+
+bool BT_request_tick_handle_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(4)) {
+        return false;
+    }
+    if (!writer.writeTag("tick_handle", 1, 2)) {
+        return false;
+    }
+    if (!writer.writeI32(m_handle)) {
+        return false;
+    }
+    if (!writer.write(m_params)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_tick_handle_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    int32_t ecast15;
+    ReturnStatusVocab cvrt16;
+    if (!reader.readEnum(ecast15, cvrt16)) {
+        reader.fail();
+        return false;
+    } else {
+        s_return_helper = static_cast<ReturnStatus>(ecast15);
+    }
+    return true;
+}
+
+class BT_request_tick_versioned_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_tick_versioned_helper(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::int32_t m_handle;
+    std::int64_t m_version;
+    bool m_with_params;
+    yarp::os::Property m_params;
+
+    thread_local static TickReply s_return_helper;
+};
+
+thread_local TickReply BT_request_tick_versioned_helper::s_return_helper = {};
+
+BT_request_tick_versioned_helper::BT_request_tick_versioned_helper(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params) :
+        m_handle{handle},
+        m_version{version},
+        m_with_params{with_params},
+        m_params{params}
+{
+}
+
+bool BT_request_tick_versioned_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(6)) {
+        return false;
+    }
+    if (!writer.writeTag("tick_versioned", 1, 2)) {
+        return false;
+    }
+    if (!writer.writeI32(m_handle)) {
+        return false;
+    }
+    if (!writer.writeI64(m_version)) {
+        return false;
+    }
+    if (!writer.writeBool(m_with_params)) {
+        return false;
+    }
+    if (!writer.write(m_params)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_tick_versioned_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BT_request_halt_handle_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_halt_handle_helper(const std::int32_t handle, const yarp::os::Property& params);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::int32_t m_handle;
+    yarp::os::Property m_params;
+
+    thread_local static ReturnStatus s_return_helper;
+};
+
+thread_local ReturnStatus BT_request_halt_handle_helper::s_return_helper = {};
+
+BT_request_halt_handle_helper::BT_request_halt_handle_helper(const std::int32_t handle, const yarp::os::Property& params) :
+        m_handle{handle},
+        m_params{params}
+{
+    s_return_helper = {};
+}
+
+bool BT_request_halt_handle_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(4)) {
+        return false;
+    }
+    if (!writer.writeTag("halt_handle", 1, 2)) {
+        return false;
+    }
+    if (!writer.writeI32(m_handle)) {
+        return false;
+    }
+    if (!writer.write(m_params)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_halt_handle_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    int32_t ecast17;
+    ReturnStatusVocab cvrt18;
+    if (!reader.readEnum(ecast17, cvrt18)) {
+        reader.fail();
+        return false;
+    } else {
+        s_return_helper = static_cast<ReturnStatus>(ecast17);
+    }
+    return true;
+}
+
+class BT_request_status_handle_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_status_handle_helper(const std::int32_t handle);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::int32_t m_handle;
+
+    thread_local static ReturnStatus s_return_helper;
+};
+
+thread_local ReturnStatus BT_request_status_handle_helper::s_return_helper = {};
+
+BT_request_status_handle_helper::BT_request_status_handle_helper(const std::int32_t handle) :
+        m_handle{handle}
+{
+    s_return_helper = {};
+}
+
+bool BT_request_status_handle_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    if (!writer.writeTag("status_handle", 1, 2)) {
+        return false;
+    }
+    if (!writer.writeI32(m_handle)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_status_handle_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    int32_t ecast19;
+    ReturnStatusVocab cvrt20;
+    if (!reader.readEnum(ecast19, cvrt20)) {
+        reader.fail();
+        return false;
+    } else {
+        s_return_helper = static_cast<ReturnStatus>(ecast19);
+    }
+    return true;
+}
+
 class BT_request_request_initialize_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BT_request_request_initialize_helper();
+    explicit BT_request_request_initialize_helper();
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    thread_local static bool s_return_helper;
+};
+
+thread_local bool BT_request_request_initialize_helper::s_return_helper = {};
+
+BT_request_request_initialize_helper::BT_request_request_initialize_helper()
+{
+    s_return_helper = {};
+}
+
+bool BT_request_request_initialize_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(2)) {
+        return false;
+    }
+    if (!writer.writeTag("request_initialize", 1, 2)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_request_initialize_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.readBool(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BT_request_request_terminate_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_request_terminate_helper();
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
 
     thread_local static bool s_return_helper;
 };
 
-thread_local bool BT_request_request_initialize_helper::s_return_helper = {};
+thread_local bool BT_request_request_terminate_helper::s_return_helper = {};
 
-BT_request_request_initialize_helper::BT_request_request_initialize_helper()
+BT_request_request_terminate_helper::BT_request_request_terminate_helper()
 {
     s_return_helper = {};
 }
 
-bool BT_request_request_initialize_helper::write(yarp::os::ConnectionWriter& connection) const
+bool BT_request_request_terminate_helper::write(yarp::os::ConnectionWriter& connection) const
 {
     yarp::os::idl::WireWriter writer(connection);
     if (!writer.writeListHeader(2)) {
         return false;
     }
-    if (!writer.writeTag("request_initialize", 1, 2)) {
+    if (!writer.writeTag("request_terminate", 1, 2)) {
         return false;
     }
     return true;
 }
 
-bool BT_request_request_initialize_helper::read(yarp::os::ConnectionReader& connection)
+bool BT_request_request_terminate_helper::read(yarp::os::ConnectionReader& connection)
 {
     yarp::os::idl::WireReader reader(connection);
     if (!reader.readListReturn()) {
@@ -230,37 +635,79 @@ bool BT_request_request_initialize_helper::read(yarp::os::ConnectionReader& conn
     return true;
 }
 
-class BT_request_request_terminate_helper :
+class BT_request_request_stats_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BT_request_request_terminate_helper();
+    explicit BT_request_request_stats_helper();
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    thread_local static yarp::os::Property s_return_helper;
+};
+
+thread_local yarp::os::Property BT_request_request_stats_helper::s_return_helper = {};
+
+BT_request_request_stats_helper::BT_request_request_stats_helper()
+{
+}
+
+bool BT_request_request_stats_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(2)) {
+        return false;
+    }
+    if (!writer.writeTag("request_stats", 1, 2)) {
+        return false;
+    }
+    return true;
+}
+
+bool BT_request_request_stats_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BT_request_reset_stats_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BT_request_reset_stats_helper();
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
 
     thread_local static bool s_return_helper;
 };
 
-thread_local bool BT_request_request_terminate_helper::s_return_helper = {};
+thread_local bool BT_request_reset_stats_helper::s_return_helper = {};
 
-BT_request_request_terminate_helper::BT_request_request_terminate_helper()
+BT_request_reset_stats_helper::BT_request_reset_stats_helper()
 {
     s_return_helper = {};
 }
 
-bool BT_request_request_terminate_helper::write(yarp::os::ConnectionWriter& connection) const
+bool BT_request_reset_stats_helper::write(yarp::os::ConnectionWriter& connection) const
 {
     yarp::os::idl::WireWriter writer(connection);
     if (!writer.writeListHeader(2)) {
         return false;
     }
-    if (!writer.writeTag("request_terminate", 1, 2)) {
+    if (!writer.writeTag("reset_stats", 1, 2)) {
         return false;
     }
     return true;
 }
 
-bool BT_request_request_terminate_helper::read(yarp::os::ConnectionReader& connection)
+bool BT_request_reset_stats_helper::read(yarp::os::ConnectionReader& connection)
 {
     yarp::os::idl::WireReader reader(connection);
     if (!reader.readListReturn()) {
@@ -309,6 +756,66 @@ ReturnStatus BT_request::request_halt(const ActionID& target, const yarp::os::Pr
     return ok ? BT_request_request_halt_helper::s_return_helper : ReturnStatus{};
 }
 
+std::vector<ReturnStatus> BT_request::request_batch_tick(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params)
+{
+    BT_request_request_batch_tick_helper helper{targets, params};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "std::vector<ReturnStatus> BT_request::request_batch_tick(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_request_batch_tick_helper::s_return_helper : std::vector<ReturnStatus>{};
+}
+
+std::int32_t BT_request::register_target(const ActionID& target)
+{
+    BT_request_register_target_helper helper{target};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "std::int32_t BT_request::register_target(const ActionID& target)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_register_target_helper::s_return_helper : std::int32_t{};
+}
+
+ReturnStatus BT_request::tick_handle(const std::int32_t handle, const yarp::os::Property& params)
+{
+    BT_request_tick_handle_helper helper{handle, params};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "ReturnStatus BT_request::tick_handle(const std::int32_t handle, const yarp::os::Property& params)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_tick_handle_helper::s_return_helper : ReturnStatus{};
+}
+
+TickReply BT_request::tick_versioned(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params)
+{
+    BT_request_tick_versioned_helper helper{handle, version, with_params, params};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "TickReply BT_request::tick_versioned(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_tick_versioned_helper::s_return_helper : TickReply{};
+}
+
+ReturnStatus BT_request::halt_handle(const std::int32_t handle, const yarp::os::Property& params)
+{
+    BT_request_halt_handle_helper helper{handle, params};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "ReturnStatus BT_request::halt_handle(const std::int32_t handle, const yarp::os::Property& params)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_halt_handle_helper::s_return_helper : ReturnStatus{};
+}
+
+ReturnStatus BT_request::status_handle(const std::int32_t handle)
+{
+    BT_request_status_handle_helper helper{handle};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "ReturnStatus BT_request::status_handle(const std::int32_t handle)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_status_handle_helper::s_return_helper : ReturnStatus{};
+}
+
 bool BT_request::request_initialize()
 {
     BT_request_request_initialize_helper helper{};
@@ -329,6 +836,26 @@ bool BT_request::request_terminate()
     return ok ? BT_request_request_terminate_helper::s_return_helper : bool{};
 }
 
+yarp::os::Property BT_request::request_stats()
+{
+    BT_request_request_stats_helper helper{};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "yarp::os::Property BT_request::request_stats()");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_request_stats_helper::s_return_helper : yarp::os::Property{};
+}
+
+bool BT_request::reset_stats()
+{
+    BT_request_reset_stats_helper helper{};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BT_request::reset_stats()");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BT_request_reset_stats_helper::s_return_helper : bool{};
+}
+
 // help method
 std::vector<std::string> BT_request::help(const std::string& functionName)
 {
@@ -339,8 +866,16 @@ std::vector<std::string> BT_request::help(const std::string& functionName)
         helpString.emplace_back("request_status");
         helpString.emplace_back("request_tick");
         helpString.emplace_back("request_halt");
+        helpString.emplace_back("request_batch_tick");
+        helpString.emplace_back("register_target");
+        helpString.emplace_back("tick_handle");
+        helpString.emplace_back("tick_versioned");
+        helpString.emplace_back("halt_handle");
+        helpString.emplace_back("status_handle");
         helpString.emplace_back("request_initialize");
         helpString.emplace_back("request_terminate");
+        helpString.emplace_back("request_stats");
+        helpString.emplace_back("reset_stats");
         helpString.emplace_back("help");
     } else {
         if (functionName == "request_status") {
@@ -374,6 +909,50 @@ std::vector<std::string> BT_request::help(const std::string& functionName)
             helpString.emplace_back("                     the params may contain the max deceleration to apply. ");
             helpString.emplace_back("return              The enum indicating the status of the action on the server side. ");
         }
+        if (functionName == "request_batch_tick") {
+            helpString.emplace_back("std::vector<ReturnStatus> request_batch_tick(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params) ");
+            helpString.emplace_back("request_batch_tick  Send the Tick requests of several actions handled by this server in a single message. ");
+            helpString.emplace_back("                     It is equivalent to calling request_tick for each element of <targets>, in order, ");
+            helpString.emplace_back("                     but it costs a single round trip. ");
+            helpString.emplace_back("targets       The actions to tick. ");
+            helpString.emplace_back("params        The parameters of each action, matched to <targets> by position. ");
+            helpString.emplace_back("                     If shorter than <targets>, missing entries are empty. ");
+            helpString.emplace_back("return              The status of each action, in the same order as <targets>. ");
+        }
+        if (functionName == "register_target") {
+            helpString.emplace_back("std::int32_t register_target(const ActionID& target) ");
+            helpString.emplace_back("register_target  Bind an ActionID to a compact handle, to be used by the *_handle methods below ");
+            helpString.emplace_back("                     instead of sending the whole ActionID at every call. ");
+            helpString.emplace_back("                     Registering again the same ActionID returns the same handle. ");
+            helpString.emplace_back("target        The ActionID to register. ");
+            helpString.emplace_back("return              The handle, greater than zero; zero if the server cannot register more targets. ");
+        }
+        if (functionName == "tick_handle") {
+            helpString.emplace_back("ReturnStatus tick_handle(const std::int32_t handle, const yarp::os::Property& params = {  }) ");
+            helpString.emplace_back("tick_handle  Same as request_tick, for the ActionID registered with <handle>. ");
+            helpString.emplace_back("return              The enum indicating the status of the action; BT_ERROR if the handle is unknown. ");
+        }
+        if (functionName == "tick_versioned") {
+            helpString.emplace_back("TickReply tick_versioned(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params = {  }) ");
+            helpString.emplace_back("tick_versioned  Same as tick_handle, sending the params only when they change. ");
+            helpString.emplace_back("                     The server keeps the last params received for each action along with their version, ");
+            helpString.emplace_back("                     and uses them when the client sends the same version again without params. ");
+            helpString.emplace_back("handle        The handle of the action, from register_target. ");
+            helpString.emplace_back("version       The version of the params, e.g. a hash of their content. ");
+            helpString.emplace_back("with_params   true if <params> are sent, false to use the ones the server already has for <version>. ");
+            helpString.emplace_back("params        The params of the tick, only if <with_params> is true. ");
+            helpString.emplace_back("return              The status of the action, or params_needed set if the server does not have <version>. ");
+        }
+        if (functionName == "halt_handle") {
+            helpString.emplace_back("ReturnStatus halt_handle(const std::int32_t handle, const yarp::os::Property& params = {  }) ");
+            helpString.emplace_back("halt_handle  Same as request_halt, for the ActionID registered with <handle>. ");
+            helpString.emplace_back("return              The enum indicating the status of the action; BT_ERROR if the handle is unknown. ");
+        }
+        if (functionName == "status_handle") {
+            helpString.emplace_back("ReturnStatus status_handle(const std::int32_t handle) ");
+            helpString.emplace_back("status_handle  Same as request_status, for the ActionID registered with <handle>. ");
+            helpString.emplace_back("return              The enum indicating the status of the action; BT_ERROR if the handle is unknown. ");
+        }
         if (functionName == "request_initialize") {
             helpString.emplace_back("bool request_initialize() ");
             helpString.emplace_back(" request_initialize  Hook for an initialization callback. The client can ask the action server to perform ");
@@ -385,6 +964,18 @@ std::vector<std::string> BT_request::help(const std::string& functionName)
             helpString.emplace_back("request_terminate  The client notifies the server to close, in order to perform a graceful shutdown. ");
             helpString.emplace_back("return              true if the call was successful, false otherwise ");
         }
+        if (functionName == "request_stats") {
+            helpString.emplace_back("yarp::os::Property request_stats() ");
+            helpString.emplace_back("request_stats  Get the statistics collected by the server since start or last reset: ");
+            helpString.emplace_back("                     number of ticks and halts, number of replies for each ReturnStatus, ");
+            helpString.emplace_back("                     and the latency histograms of tick handling, user code and queueing, in microseconds. ");
+            helpString.emplace_back("return              A Property with one entry for each counter and one group for each histogram. ");
+        }
+        if (functionName == "reset_stats") {
+            helpString.emplace_back("bool reset_stats() ");
+            helpString.emplace_back("reset_stats  Clear all the statistics collected by the server. ");
+            helpString.emplace_back("return              true if the call was successful, false otherwise ");
+        }
         if (functionName == "help") {
             helpString.emplace_back("std::vector<std::string> help(const std::string& functionName = \"--all\")");
             helpString.emplace_back("Return list of available commands, or help message for a specific function");
@@ -479,6 +1070,171 @@ bool BT_request::read(yarp::os::ConnectionReader& connection)
             reader.accept();
             return true;
         }
+        if (tag == "request_batch_tick") {
+            std::vector<ActionID> targets;
+            std::vector<yarp::os::Property> params;
+            targets.clear();
+            uint32_t _size21;
+            yarp::os::idl::WireState _etype24;
+            reader.readListBegin(_etype24, _size21);
+            targets.resize(_size21);
+            for (auto& _elem25 : targets) {
+                if (!reader.readNested(_elem25)) {
+                    reader.fail();
+                    return false;
+                }
+            }
+            reader.readListEnd();
+            params.clear();
+            uint32_t _size26;
+            yarp::os::idl::WireState _etype29;
+            reader.readListBegin(_etype29, _size26);
+            params.resize(_size26);
+            for (auto& _elem30 : params) {
+                if (!reader.readNested(_elem30)) {
+                    reader.fail();
+                    return false;
+                }
+            }
+            reader.readListEnd();
+            BT_request_request_batch_tick_helper::s_return_helper = request_batch_tick(targets, params);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeListBegin(BOTTLE_TAG_INT32, static_cast<uint32_t>(BT_request_request_batch_tick_helper::s_return_helper.size()))) {
+                    return false;
+                }
+                for (const auto& _item31 : BT_request_request_batch_tick_helper::s_return_helper) {
+                    if (!writer.writeI32(static_cast<int32_t>(_item31))) {
+                        return false;
+                    }
+                }
+                if (!writer.writeListEnd()) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "register_target") {
+            ActionID target;
+            if (!reader.read(target)) {
+                reader.fail();
+                return false;
+            }
+            BT_request_register_target_helper::s_return_helper = register_target(target);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeI32(BT_request_register_target_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "tick_handle") {
+            std::int32_t handle;
+            yarp::os::Property params;
+            if (!reader.readI32(handle)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.read(params)) {
+                params = {  };
+            }
+            BT_request_tick_handle_helper::s_return_helper = tick_handle(handle, params);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeI32(static_cast<int32_t>(BT_request_tick_handle_helper::s_return_helper))) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "tick_versioned") {
+            std::int32_t handle;
+            std::int64_t version;
+            bool with_params;
+            yarp::os::Property params;
+            if (!reader.readI32(handle)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readI64(version)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readBool(with_params)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.read(params)) {
+                params = {  };
+            }
+            BT_request_tick_versioned_helper::s_return_helper = tick_versioned(handle, version, with_params, params);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BT_request_tick_versioned_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "halt_handle") {
+            std::int32_t handle;
+            yarp::os::Property params;
+            if (!reader.readI32(handle)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.read(params)) {
+                params = {  };
+            }
+            BT_request_halt_handle_helper::s_return_helper = halt_handle(handle, params);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeI32(static_cast<int32_t>(BT_request_halt_handle_helper::s_return_helper))) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "status_handle") {
+            std::int32_t handle;
+            if (!reader.readI32(handle)) {
+                reader.fail();
+                return false;
+            }
+            BT_request_status_handle_helper::s_return_helper = status_handle(handle);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeI32(static_cast<int32_t>(BT_request_status_handle_helper::s_return_helper))) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
         if (tag == "request_initialize") {
             BT_request_request_initialize_helper::s_return_helper = request_initialize();
             yarp::os::idl::WireWriter writer(reader);
@@ -507,6 +1263,34 @@ bool BT_request::read(yarp::os::ConnectionReader& connection)
             reader.accept();
             return true;
         }
+        if (tag == "request_stats") {
+            BT_request_request_stats_helper::s_return_helper = request_stats();
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BT_request_request_stats_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "reset_stats") {
+            BT_request_reset_stats_helper::s_return_helper = reset_stats();
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeBool(BT_request_reset_stats_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
         if (tag == "help") {
             std::string functionName;
             if (!reader.readString(functionName)) {
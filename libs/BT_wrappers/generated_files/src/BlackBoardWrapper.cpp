@@ -66,23 +66,76 @@ bool BlackBoardWrapper_getData_helper::read(yarp::os::ConnectionReader& connecti
     return true;
 }
 
+class BlackBoardWrapper_getDataIfChanged_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_getDataIfChanged_helper(const std::string& target, const std::int64_t knownVersion);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_target;
+    std::int64_t m_knownVersion;
+
+    thread_local static VersionedData s_return_helper;
+};
+
+thread_local VersionedData BlackBoardWrapper_getDataIfChanged_helper::s_return_helper = {};
+
+BlackBoardWrapper_getDataIfChanged_helper::BlackBoardWrapper_getDataIfChanged_helper(const std::string& target, const std::int64_t knownVersion) :
+        m_target{target},
+        m_knownVersion{knownVersion}
+{
+}
+
+bool BlackBoardWrapper_getDataIfChanged_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    if (!writer.writeTag("getDataIfChanged", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_target)) {
+        return false;
+    }
+    if (!writer.writeI64(m_knownVersion)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_getDataIfChanged_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
 class BlackBoardWrapper_setData_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BlackBoardWrapper_setData_helper(const std::string& target, const yarp::os::Property& datum);
+    explicit BlackBoardWrapper_setData_helper(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum);
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
 
     std::string m_target;
-    yarp::os::Property m_datum;
+    yarp::BT_wrappers::PropertyEntries m_datum;
 
     thread_local static bool s_return_helper;
 };
 
 thread_local bool BlackBoardWrapper_setData_helper::s_return_helper = {};
 
-BlackBoardWrapper_setData_helper::BlackBoardWrapper_setData_helper(const std::string& target, const yarp::os::Property& datum) :
+BlackBoardWrapper_setData_helper::BlackBoardWrapper_setData_helper(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum) :
         m_target{target},
         m_datum{datum}
 {
@@ -120,156 +173,233 @@ bool BlackBoardWrapper_setData_helper::read(yarp::os::ConnectionReader& connecti
     return true;
 }
 
-class BlackBoardWrapper_clearData_helper :
+class BlackBoardWrapper_setDataWithTTL_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BlackBoardWrapper_clearData_helper(const std::string& target);
+    explicit BlackBoardWrapper_setDataWithTTL_helper(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum, const double ttl);
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
 
     std::string m_target;
+    yarp::BT_wrappers::PropertyEntries m_datum;
+    double m_ttl;
+
+    thread_local static bool s_return_helper;
 };
 
-BlackBoardWrapper_clearData_helper::BlackBoardWrapper_clearData_helper(const std::string& target) :
-        m_target{target}
+thread_local bool BlackBoardWrapper_setDataWithTTL_helper::s_return_helper = {};
+
+BlackBoardWrapper_setDataWithTTL_helper::BlackBoardWrapper_setDataWithTTL_helper(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum, const double ttl) :
+        m_target{target},
+        m_datum{datum},
+        m_ttl{ttl}
 {
+    s_return_helper = {};
 }
 
-bool BlackBoardWrapper_clearData_helper::write(yarp::os::ConnectionWriter& connection) const
+bool BlackBoardWrapper_setDataWithTTL_helper::write(yarp::os::ConnectionWriter& connection) const
 {
     yarp::os::idl::WireWriter writer(connection);
-    if (!writer.writeListHeader(2)) {
+    if (!writer.writeListHeader(4)) {
         return false;
     }
-    if (!writer.writeTag("clearData", 1, 1)) {
+    if (!writer.writeTag("setDataWithTTL", 1, 1)) {
         return false;
     }
     if (!writer.writeString(m_target)) {
         return false;
     }
+    if (!writer.write(m_datum)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_ttl)) {
+        return false;
+    }
     return true;
 }
 
-bool BlackBoardWrapper_clearData_helper::read(yarp::os::ConnectionReader& connection)
+bool BlackBoardWrapper_setDataWithTTL_helper::read(yarp::os::ConnectionReader& connection)
 {
     yarp::os::idl::WireReader reader(connection);
     if (!reader.readListReturn()) {
         return false;
     }
+    if (!reader.readBool(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
     return true;
 }
 
-class BlackBoardWrapper_clearAll_helper :
+class BlackBoardWrapper_getField_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BlackBoardWrapper_clearAll_helper();
+    explicit BlackBoardWrapper_getField_helper(const std::string& target, const std::string& key);
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_target;
+    std::string m_key;
+
+    thread_local static yarp::os::Value s_return_helper;
 };
 
-BlackBoardWrapper_clearAll_helper::BlackBoardWrapper_clearAll_helper()
+thread_local yarp::os::Value BlackBoardWrapper_getField_helper::s_return_helper = {};
+
+BlackBoardWrapper_getField_helper::BlackBoardWrapper_getField_helper(const std::string& target, const std::string& key) :
+        m_target{target},
+        m_key{key}
 {
 }
 
-bool BlackBoardWrapper_clearAll_helper::write(yarp::os::ConnectionWriter& connection) const
+bool BlackBoardWrapper_getField_helper::write(yarp::os::ConnectionWriter& connection) const
 {
     yarp::os::idl::WireWriter writer(connection);
-    if (!writer.writeListHeader(1)) {
+    if (!writer.writeListHeader(3)) {
         return false;
     }
-    if (!writer.writeTag("clearAll", 1, 1)) {
+    if (!writer.writeTag("getField", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_target)) {
+        return false;
+    }
+    if (!writer.writeString(m_key)) {
         return false;
     }
     return true;
 }
 
-bool BlackBoardWrapper_clearAll_helper::read(yarp::os::ConnectionReader& connection)
+bool BlackBoardWrapper_getField_helper::read(yarp::os::ConnectionReader& connection)
 {
     yarp::os::idl::WireReader reader(connection);
     if (!reader.readListReturn()) {
         return false;
     }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
     return true;
 }
 
-class BlackBoardWrapper_resetData_helper :
+class BlackBoardWrapper_setField_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BlackBoardWrapper_resetData_helper();
+    explicit BlackBoardWrapper_setField_helper(const std::string& target, const std::string& key, const yarp::os::Value& value);
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_target;
+    std::string m_key;
+    yarp::os::Value m_value;
+
+    thread_local static bool s_return_helper;
 };
 
-BlackBoardWrapper_resetData_helper::BlackBoardWrapper_resetData_helper()
+thread_local bool BlackBoardWrapper_setField_helper::s_return_helper = {};
+
+BlackBoardWrapper_setField_helper::BlackBoardWrapper_setField_helper(const std::string& target, const std::string& key, const yarp::os::Value& value) :
+        m_target{target},
+        m_key{key},
+        m_value{value}
 {
+    s_return_helper = {};
 }
 
-bool BlackBoardWrapper_resetData_helper::write(yarp::os::ConnectionWriter& connection) const
+bool BlackBoardWrapper_setField_helper::write(yarp::os::ConnectionWriter& connection) const
 {
     yarp::os::idl::WireWriter writer(connection);
-    if (!writer.writeListHeader(1)) {
+    if (!writer.writeListHeader(4)) {
         return false;
     }
-    if (!writer.writeTag("resetData", 1, 1)) {
+    if (!writer.writeTag("setField", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_target)) {
+        return false;
+    }
+    if (!writer.writeString(m_key)) {
+        return false;
+    }
+    if (!writer.write(m_value)) {
         return false;
     }
     return true;
 }
 
-bool BlackBoardWrapper_resetData_helper::read(yarp::os::ConnectionReader& connection)
+bool BlackBoardWrapper_setField_helper::read(yarp::os::ConnectionReader& connection)
 {
     yarp::os::idl::WireReader reader(connection);
     if (!reader.readListReturn()) {
         return false;
     }
+    if (!reader.readBool(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
     return true;
 }
 
-class BlackBoardWrapper_listTarget_helper :
+class BlackBoardWrapper_getMany_helper :
         public yarp::os::Portable
 {
 public:
-    explicit BlackBoardWrapper_listTarget_helper();
+    explicit BlackBoardWrapper_getMany_helper(const std::vector<std::string>& targets);
     bool write(yarp::os::ConnectionWriter& connection) const override;
     bool read(yarp::os::ConnectionReader& connection) override;
 
-    thread_local static std::vector<std::string> s_return_helper;
+    std::vector<std::string> m_targets;
+
+    thread_local static std::vector<yarp::os::Property> s_return_helper;
 };
 
-thread_local std::vector<std::string> BlackBoardWrapper_listTarget_helper::s_return_helper = {};
+thread_local std::vector<yarp::os::Property> BlackBoardWrapper_getMany_helper::s_return_helper = {};
 
-BlackBoardWrapper_listTarget_helper::BlackBoardWrapper_listTarget_helper()
+BlackBoardWrapper_getMany_helper::BlackBoardWrapper_getMany_helper(const std::vector<std::string>& targets) :
+        m_targets{targets}
 {
 }
 
-bool BlackBoardWrapper_listTarget_helper::write(yarp::os::ConnectionWriter& connection) const
+bool BlackBoardWrapper_getMany_helper::write(yarp::os::ConnectionWriter& connection) const
 {
     yarp::os::idl::WireWriter writer(connection);
-    if (!writer.writeListHeader(1)) {
+    if (!writer.writeListHeader(2)) {
         return false;
     }
-    if (!writer.writeTag("listTarget", 1, 1)) {
+    if (!writer.writeTag("getMany", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeListBegin(BOTTLE_TAG_STRING, static_cast<uint32_t>(m_targets.size()))) {
+        return false;
+    }
+    for (const auto& _item0 : m_targets) {
+        if (!writer.writeString(_item0)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
         return false;
     }
     return true;
 }
 
-bool BlackBoardWrapper_listTarget_helper::read(yarp::os::ConnectionReader& connection)
+bool BlackBoardWrapper_getMany_helper::read(yarp::os::ConnectionReader& connection)
 {
     yarp::os::idl::WireReader reader(connection);
     if (!reader.readListReturn()) {
         return false;
     }
     s_return_helper.clear();
-    uint32_t _size0;
-    yarp::os::idl::WireState _etype3;
-    reader.readListBegin(_etype3, _size0);
-    s_return_helper.resize(_size0);
-    for (auto& _elem4 : s_return_helper) {
-        if (!reader.readString(_elem4)) {
+    uint32_t _size1;
+    yarp::os::idl::WireState _etype4;
+    reader.readListBegin(_etype4, _size1);
+    s_return_helper.resize(_size1);
+    for (auto& _elem5 : s_return_helper) {
+        if (!reader.readNested(_elem5)) {
             reader.fail();
             return false;
         }
@@ -278,89 +408,907 @@ bool BlackBoardWrapper_listTarget_helper::read(yarp::os::ConnectionReader& conne
     return true;
 }
 
-// Constructor
-BlackBoardWrapper::BlackBoardWrapper()
+class BlackBoardWrapper_setMany_helper :
+        public yarp::os::Portable
 {
-    yarp().setOwner(*this);
+public:
+    explicit BlackBoardWrapper_setMany_helper(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::vector<std::string> m_targets;
+    std::vector<yarp::os::Property> m_data;
+
+    thread_local static bool s_return_helper;
+};
+
+thread_local bool BlackBoardWrapper_setMany_helper::s_return_helper = {};
+
+BlackBoardWrapper_setMany_helper::BlackBoardWrapper_setMany_helper(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data) :
+        m_targets{targets},
+        m_data{data}
+{
+    s_return_helper = {};
 }
 
-yarp::os::Property BlackBoardWrapper::getData(const std::string& target)
+bool BlackBoardWrapper_setMany_helper::write(yarp::os::ConnectionWriter& connection) const
 {
-    BlackBoardWrapper_getData_helper helper{target};
-    if (!yarp().canWrite()) {
-        yError("Missing server method '%s'?", "yarp::os::Property BlackBoardWrapper::getData(const std::string& target)");
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
     }
-    bool ok = yarp().write(helper, helper);
-    return ok ? BlackBoardWrapper_getData_helper::s_return_helper : yarp::os::Property{};
+    if (!writer.writeTag("setMany", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeListBegin(BOTTLE_TAG_STRING, static_cast<uint32_t>(m_targets.size()))) {
+        return false;
+    }
+    for (const auto& _item6 : m_targets) {
+        if (!writer.writeString(_item6)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(m_data.size()))) {
+        return false;
+    }
+    for (const auto& _item7 : m_data) {
+        if (!writer.writeNested(_item7)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
 }
 
-bool BlackBoardWrapper::setData(const std::string& target, const yarp::os::Property& datum)
+bool BlackBoardWrapper_setMany_helper::read(yarp::os::ConnectionReader& connection)
 {
-    BlackBoardWrapper_setData_helper helper{target, datum};
-    if (!yarp().canWrite()) {
-        yError("Missing server method '%s'?", "bool BlackBoardWrapper::setData(const std::string& target, const yarp::os::Property& datum)");
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
     }
-    bool ok = yarp().write(helper, helper);
-    return ok ? BlackBoardWrapper_setData_helper::s_return_helper : bool{};
+    if (!reader.readBool(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
 }
 
-void BlackBoardWrapper::clearData(const std::string& target)
+class BlackBoardWrapper_clearData_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_clearData_helper(const std::string& target);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_target;
+};
+
+BlackBoardWrapper_clearData_helper::BlackBoardWrapper_clearData_helper(const std::string& target) :
+        m_target{target}
 {
-    BlackBoardWrapper_clearData_helper helper{target};
-    if (!yarp().canWrite()) {
-        yError("Missing server method '%s'?", "void BlackBoardWrapper::clearData(const std::string& target)");
-    }
-    yarp().write(helper, helper);
 }
 
-void BlackBoardWrapper::clearAll()
+bool BlackBoardWrapper_clearData_helper::write(yarp::os::ConnectionWriter& connection) const
 {
-    BlackBoardWrapper_clearAll_helper helper{};
-    if (!yarp().canWrite()) {
-        yError("Missing server method '%s'?", "void BlackBoardWrapper::clearAll()");
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(2)) {
+        return false;
     }
-    yarp().write(helper, helper);
+    if (!writer.writeTag("clearData", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_target)) {
+        return false;
+    }
+    return true;
 }
 
-void BlackBoardWrapper::resetData()
+bool BlackBoardWrapper_clearData_helper::read(yarp::os::ConnectionReader& connection)
 {
-    BlackBoardWrapper_resetData_helper helper{};
-    if (!yarp().canWrite()) {
-        yError("Missing server method '%s'?", "void BlackBoardWrapper::resetData()");
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
     }
-    yarp().write(helper, helper);
+    return true;
 }
 
-std::vector<std::string> BlackBoardWrapper::listTarget()
+class BlackBoardWrapper_clearAll_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_clearAll_helper();
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+};
+
+BlackBoardWrapper_clearAll_helper::BlackBoardWrapper_clearAll_helper()
 {
-    BlackBoardWrapper_listTarget_helper helper{};
-    if (!yarp().canWrite()) {
-        yError("Missing server method '%s'?", "std::vector<std::string> BlackBoardWrapper::listTarget()");
-    }
-    bool ok = yarp().write(helper, helper);
-    return ok ? BlackBoardWrapper_listTarget_helper::s_return_helper : std::vector<std::string>{};
 }
 
-// help method
-std::vector<std::string> BlackBoardWrapper::help(const std::string& functionName)
+bool BlackBoardWrapper_clearAll_helper::write(yarp::os::ConnectionWriter& connection) const
 {
-    bool showAll = (functionName == "--all");
-    std::vector<std::string> helpString;
-    if (showAll) {
-        helpString.emplace_back("*** Available commands:");
-        helpString.emplace_back("getData");
-        helpString.emplace_back("setData");
-        helpString.emplace_back("clearData");
-        helpString.emplace_back("clearAll");
-        helpString.emplace_back("resetData");
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(1)) {
+        return false;
+    }
+    if (!writer.writeTag("clearAll", 1, 1)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_clearAll_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    return true;
+}
+
+class BlackBoardWrapper_resetData_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_resetData_helper();
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+};
+
+BlackBoardWrapper_resetData_helper::BlackBoardWrapper_resetData_helper()
+{
+}
+
+bool BlackBoardWrapper_resetData_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(1)) {
+        return false;
+    }
+    if (!writer.writeTag("resetData", 1, 1)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_resetData_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    return true;
+}
+
+class BlackBoardWrapper_listTarget_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_listTarget_helper();
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    thread_local static std::vector<std::string> s_return_helper;
+};
+
+thread_local std::vector<std::string> BlackBoardWrapper_listTarget_helper::s_return_helper = {};
+
+BlackBoardWrapper_listTarget_helper::BlackBoardWrapper_listTarget_helper()
+{
+}
+
+bool BlackBoardWrapper_listTarget_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(1)) {
+        return false;
+    }
+    if (!writer.writeTag("listTarget", 1, 1)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_listTarget_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    s_return_helper.clear();
+    uint32_t _size8;
+    yarp::os::idl::WireState _etype11;
+    reader.readListBegin(_etype11, _size8);
+    s_return_helper.resize(_size8);
+    for (auto& _elem12 : s_return_helper) {
+        if (!reader.readString(_elem12)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+class BlackBoardWrapper_listTargets_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_listTargets_helper(const std::string& prefix, const std::int32_t limit, const std::string& cursor);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_prefix;
+    std::int32_t m_limit;
+    std::string m_cursor;
+
+    thread_local static TargetPage s_return_helper;
+};
+
+thread_local TargetPage BlackBoardWrapper_listTargets_helper::s_return_helper = {};
+
+BlackBoardWrapper_listTargets_helper::BlackBoardWrapper_listTargets_helper(const std::string& prefix, const std::int32_t limit, const std::string& cursor) :
+        m_prefix{prefix},
+        m_limit{limit},
+        m_cursor{cursor}
+{
+}
+
+bool BlackBoardWrapper_listTargets_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(4)) {
+        return false;
+    }
+    if (!writer.writeTag("listTargets", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_prefix)) {
+        return false;
+    }
+    if (!writer.writeI32(m_limit)) {
+        return false;
+    }
+    if (!writer.writeString(m_cursor)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_listTargets_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BlackBoardWrapper_scan_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_scan_helper(const std::string& prefix, const std::int32_t limit, const std::string& cursor);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_prefix;
+    std::int32_t m_limit;
+    std::string m_cursor;
+
+    thread_local static TargetPage s_return_helper;
+};
+
+thread_local TargetPage BlackBoardWrapper_scan_helper::s_return_helper = {};
+
+BlackBoardWrapper_scan_helper::BlackBoardWrapper_scan_helper(const std::string& prefix, const std::int32_t limit, const std::string& cursor) :
+        m_prefix{prefix},
+        m_limit{limit},
+        m_cursor{cursor}
+{
+}
+
+bool BlackBoardWrapper_scan_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(4)) {
+        return false;
+    }
+    if (!writer.writeTag("scan", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_prefix)) {
+        return false;
+    }
+    if (!writer.writeI32(m_limit)) {
+        return false;
+    }
+    if (!writer.writeString(m_cursor)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_scan_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BlackBoardWrapper_getMemoryStats_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_getMemoryStats_helper();
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    thread_local static yarp::os::Property s_return_helper;
+};
+
+thread_local yarp::os::Property BlackBoardWrapper_getMemoryStats_helper::s_return_helper = {};
+
+BlackBoardWrapper_getMemoryStats_helper::BlackBoardWrapper_getMemoryStats_helper()
+{
+}
+
+bool BlackBoardWrapper_getMemoryStats_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(1)) {
+        return false;
+    }
+    if (!writer.writeTag("getMemoryStats", 1, 1)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_getMemoryStats_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.read(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BlackBoardWrapper_findInRadius_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_findInRadius_helper(const std::string& mapId, const double x, const double y, const double z, const double radius);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_mapId;
+    double m_x;
+    double m_y;
+    double m_z;
+    double m_radius;
+
+    thread_local static std::vector<SpatialMatch> s_return_helper;
+};
+
+thread_local std::vector<SpatialMatch> BlackBoardWrapper_findInRadius_helper::s_return_helper = {};
+
+BlackBoardWrapper_findInRadius_helper::BlackBoardWrapper_findInRadius_helper(const std::string& mapId, const double x, const double y, const double z, const double radius) :
+        m_mapId{mapId},
+        m_x{x},
+        m_y{y},
+        m_z{z},
+        m_radius{radius}
+{
+}
+
+bool BlackBoardWrapper_findInRadius_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(6)) {
+        return false;
+    }
+    if (!writer.writeTag("findInRadius", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_mapId)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_x)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_y)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_z)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_radius)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_findInRadius_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    s_return_helper.clear();
+    uint32_t _size13;
+    yarp::os::idl::WireState _etype16;
+    reader.readListBegin(_etype16, _size13);
+    s_return_helper.resize(_size13);
+    for (auto& _elem17 : s_return_helper) {
+        if (!reader.readNested(_elem17)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+class BlackBoardWrapper_findNearest_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_findNearest_helper(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_mapId;
+    double m_x;
+    double m_y;
+    double m_z;
+    std::int32_t m_count;
+
+    thread_local static std::vector<SpatialMatch> s_return_helper;
+};
+
+thread_local std::vector<SpatialMatch> BlackBoardWrapper_findNearest_helper::s_return_helper = {};
+
+BlackBoardWrapper_findNearest_helper::BlackBoardWrapper_findNearest_helper(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count) :
+        m_mapId{mapId},
+        m_x{x},
+        m_y{y},
+        m_z{z},
+        m_count{count}
+{
+}
+
+bool BlackBoardWrapper_findNearest_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(6)) {
+        return false;
+    }
+    if (!writer.writeTag("findNearest", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_mapId)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_x)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_y)) {
+        return false;
+    }
+    if (!writer.writeFloat64(m_z)) {
+        return false;
+    }
+    if (!writer.writeI32(m_count)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_findNearest_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    s_return_helper.clear();
+    uint32_t _size18;
+    yarp::os::idl::WireState _etype21;
+    reader.readListBegin(_etype21, _size18);
+    s_return_helper.resize(_size18);
+    for (auto& _elem22 : s_return_helper) {
+        if (!reader.readNested(_elem22)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+class BlackBoardWrapper_watch_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_watch_helper(const std::string& pattern, const std::string& subscriber);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_pattern;
+    std::string m_subscriber;
+
+    thread_local static bool s_return_helper;
+};
+
+thread_local bool BlackBoardWrapper_watch_helper::s_return_helper = {};
+
+BlackBoardWrapper_watch_helper::BlackBoardWrapper_watch_helper(const std::string& pattern, const std::string& subscriber) :
+        m_pattern{pattern},
+        m_subscriber{subscriber}
+{
+    s_return_helper = {};
+}
+
+bool BlackBoardWrapper_watch_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    if (!writer.writeTag("watch", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_pattern)) {
+        return false;
+    }
+    if (!writer.writeString(m_subscriber)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_watch_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.readBool(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+class BlackBoardWrapper_unwatch_helper :
+        public yarp::os::Portable
+{
+public:
+    explicit BlackBoardWrapper_unwatch_helper(const std::string& pattern, const std::string& subscriber);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    std::string m_pattern;
+    std::string m_subscriber;
+
+    thread_local static bool s_return_helper;
+};
+
+thread_local bool BlackBoardWrapper_unwatch_helper::s_return_helper = {};
+
+BlackBoardWrapper_unwatch_helper::BlackBoardWrapper_unwatch_helper(const std::string& pattern, const std::string& subscriber) :
+        m_pattern{pattern},
+        m_subscriber{subscriber}
+{
+    s_return_helper = {};
+}
+
+bool BlackBoardWrapper_unwatch_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    if (!writer.writeTag("unwatch", 1, 1)) {
+        return false;
+    }
+    if (!writer.writeString(m_pattern)) {
+        return false;
+    }
+    if (!writer.writeString(m_subscriber)) {
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardWrapper_unwatch_helper::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (!reader.readBool(s_return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// Constructor
+BlackBoardWrapper::BlackBoardWrapper()
+{
+    yarp().setOwner(*this);
+}
+
+yarp::os::Property BlackBoardWrapper::getData(const std::string& target)
+{
+    BlackBoardWrapper_getData_helper helper{target};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "yarp::os::Property BlackBoardWrapper::getData(const std::string& target)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_getData_helper::s_return_helper : yarp::os::Property{};
+}
+
+VersionedData BlackBoardWrapper::getDataIfChanged(const std::string& target, const std::int64_t knownVersion)
+{
+    BlackBoardWrapper_getDataIfChanged_helper helper{target, knownVersion};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "VersionedData BlackBoardWrapper::getDataIfChanged(const std::string& target, const std::int64_t knownVersion)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_getDataIfChanged_helper::s_return_helper : VersionedData{};
+}
+
+bool BlackBoardWrapper::setData(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum)
+{
+    BlackBoardWrapper_setData_helper helper{target, datum};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BlackBoardWrapper::setData(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_setData_helper::s_return_helper : bool{};
+}
+
+bool BlackBoardWrapper::setDataWithTTL(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum, const double ttl)
+{
+    BlackBoardWrapper_setDataWithTTL_helper helper{target, datum, ttl};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BlackBoardWrapper::setDataWithTTL(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum, const double ttl)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_setDataWithTTL_helper::s_return_helper : bool{};
+}
+
+yarp::os::Value BlackBoardWrapper::getField(const std::string& target, const std::string& key)
+{
+    BlackBoardWrapper_getField_helper helper{target, key};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "yarp::os::Value BlackBoardWrapper::getField(const std::string& target, const std::string& key)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_getField_helper::s_return_helper : yarp::os::Value{};
+}
+
+bool BlackBoardWrapper::setField(const std::string& target, const std::string& key, const yarp::os::Value& value)
+{
+    BlackBoardWrapper_setField_helper helper{target, key, value};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BlackBoardWrapper::setField(const std::string& target, const std::string& key, const yarp::os::Value& value)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_setField_helper::s_return_helper : bool{};
+}
+
+std::vector<yarp::os::Property> BlackBoardWrapper::getMany(const std::vector<std::string>& targets)
+{
+    BlackBoardWrapper_getMany_helper helper{targets};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "std::vector<yarp::os::Property> BlackBoardWrapper::getMany(const std::vector<std::string>& targets)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_getMany_helper::s_return_helper : std::vector<yarp::os::Property>{};
+}
+
+bool BlackBoardWrapper::setMany(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data)
+{
+    BlackBoardWrapper_setMany_helper helper{targets, data};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BlackBoardWrapper::setMany(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_setMany_helper::s_return_helper : bool{};
+}
+
+void BlackBoardWrapper::clearData(const std::string& target)
+{
+    BlackBoardWrapper_clearData_helper helper{target};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "void BlackBoardWrapper::clearData(const std::string& target)");
+    }
+    yarp().write(helper, helper);
+}
+
+void BlackBoardWrapper::clearAll()
+{
+    BlackBoardWrapper_clearAll_helper helper{};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "void BlackBoardWrapper::clearAll()");
+    }
+    yarp().write(helper, helper);
+}
+
+void BlackBoardWrapper::resetData()
+{
+    BlackBoardWrapper_resetData_helper helper{};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "void BlackBoardWrapper::resetData()");
+    }
+    yarp().write(helper, helper);
+}
+
+std::vector<std::string> BlackBoardWrapper::listTarget()
+{
+    BlackBoardWrapper_listTarget_helper helper{};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "std::vector<std::string> BlackBoardWrapper::listTarget()");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_listTarget_helper::s_return_helper : std::vector<std::string>{};
+}
+
+TargetPage BlackBoardWrapper::listTargets(const std::string& prefix, const std::int32_t limit, const std::string& cursor)
+{
+    BlackBoardWrapper_listTargets_helper helper{prefix, limit, cursor};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "TargetPage BlackBoardWrapper::listTargets(const std::string& prefix, const std::int32_t limit, const std::string& cursor)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_listTargets_helper::s_return_helper : TargetPage{};
+}
+
+TargetPage BlackBoardWrapper::scan(const std::string& prefix, const std::int32_t limit, const std::string& cursor)
+{
+    BlackBoardWrapper_scan_helper helper{prefix, limit, cursor};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "TargetPage BlackBoardWrapper::scan(const std::string& prefix, const std::int32_t limit, const std::string& cursor)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_scan_helper::s_return_helper : TargetPage{};
+}
+
+yarp::os::Property BlackBoardWrapper::getMemoryStats()
+{
+    BlackBoardWrapper_getMemoryStats_helper helper{};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "yarp::os::Property BlackBoardWrapper::getMemoryStats()");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_getMemoryStats_helper::s_return_helper : yarp::os::Property{};
+}
+
+std::vector<SpatialMatch> BlackBoardWrapper::findInRadius(const std::string& mapId, const double x, const double y, const double z, const double radius)
+{
+    BlackBoardWrapper_findInRadius_helper helper{mapId, x, y, z, radius};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "std::vector<SpatialMatch> BlackBoardWrapper::findInRadius(const std::string& mapId, const double x, const double y, const double z, const double radius)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_findInRadius_helper::s_return_helper : std::vector<SpatialMatch>{};
+}
+
+std::vector<SpatialMatch> BlackBoardWrapper::findNearest(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count)
+{
+    BlackBoardWrapper_findNearest_helper helper{mapId, x, y, z, count};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "std::vector<SpatialMatch> BlackBoardWrapper::findNearest(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_findNearest_helper::s_return_helper : std::vector<SpatialMatch>{};
+}
+
+bool BlackBoardWrapper::watch(const std::string& pattern, const std::string& subscriber)
+{
+    BlackBoardWrapper_watch_helper helper{pattern, subscriber};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BlackBoardWrapper::watch(const std::string& pattern, const std::string& subscriber)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_watch_helper::s_return_helper : bool{};
+}
+
+bool BlackBoardWrapper::unwatch(const std::string& pattern, const std::string& subscriber)
+{
+    BlackBoardWrapper_unwatch_helper helper{pattern, subscriber};
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", "bool BlackBoardWrapper::unwatch(const std::string& pattern, const std::string& subscriber)");
+    }
+    bool ok = yarp().write(helper, helper);
+    return ok ? BlackBoardWrapper_unwatch_helper::s_return_helper : bool{};
+}
+
+// help method
+std::vector<std::string> BlackBoardWrapper::help(const std::string& functionName)
+{
+    bool showAll = (functionName == "--all");
+    std::vector<std::string> helpString;
+    if (showAll) {
+        helpString.emplace_back("*** Available commands:");
+        helpString.emplace_back("getData");
+        helpString.emplace_back("getDataIfChanged");
+        helpString.emplace_back("setData");
+        helpString.emplace_back("setDataWithTTL");
+        helpString.emplace_back("getField");
+        helpString.emplace_back("setField");
+        helpString.emplace_back("getMany");
+        helpString.emplace_back("setMany");
+        helpString.emplace_back("clearData");
+        helpString.emplace_back("clearAll");
+        helpString.emplace_back("resetData");
         helpString.emplace_back("listTarget");
+        helpString.emplace_back("listTargets");
+        helpString.emplace_back("scan");
+        helpString.emplace_back("getMemoryStats");
+        helpString.emplace_back("findInRadius");
+        helpString.emplace_back("findNearest");
+        helpString.emplace_back("watch");
+        helpString.emplace_back("unwatch");
         helpString.emplace_back("help");
     } else {
         if (functionName == "getData") {
             helpString.emplace_back("yarp::os::Property getData(const std::string& target) ");
         }
+        if (functionName == "getDataIfChanged") {
+            helpString.emplace_back("VersionedData getDataIfChanged(const std::string& target, const std::int64_t knownVersion) ");
+            helpString.emplace_back("Get the content of <target> only if its version differs from <knownVersion>. ");
+            helpString.emplace_back("Targets not existing are always reported as changed. ");
+        }
         if (functionName == "setData") {
-            helpString.emplace_back("bool setData(const std::string& target, const yarp::os::Property& datum) ");
+            helpString.emplace_back("bool setData(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum) ");
+        }
+        if (functionName == "setDataWithTTL") {
+            helpString.emplace_back("bool setDataWithTTL(const std::string& target, const yarp::BT_wrappers::PropertyEntries& datum, const double ttl) ");
+            helpString.emplace_back("Merge <datum> into <target> as setData, then drop the whole target <ttl> seconds later. ");
+            helpString.emplace_back("A <ttl> of zero or less removes the expiration of <target>; setData leaves it as it is. ");
+        }
+        if (functionName == "getField") {
+            helpString.emplace_back("yarp::os::Value getField(const std::string& target, const std::string& key) ");
+            helpString.emplace_back("Get the value of the field <key> of <target>, a null Value if missing. ");
+        }
+        if (functionName == "setField") {
+            helpString.emplace_back("bool setField(const std::string& target, const std::string& key, const yarp::os::Value& value) ");
+            helpString.emplace_back("Set the field <key> of <target> to <value>, leaving the other fields as they are. ");
+        }
+        if (functionName == "getMany") {
+            helpString.emplace_back("std::vector<yarp::os::Property> getMany(const std::vector<std::string>& targets) ");
+            helpString.emplace_back("Get the content of several targets at once, in the same order as <targets>. ");
+            helpString.emplace_back("The contents are read together, so they are consistent with each other. ");
+        }
+        if (functionName == "setMany") {
+            helpString.emplace_back("bool setMany(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data) ");
+            helpString.emplace_back("Merge data[i] into targets[i], as setData, for all i at once. ");
+            helpString.emplace_back("The writes are applied together: readers see either none or all of them. ");
+            helpString.emplace_back("Returns false, without writing anything, if the lists have different sizes. ");
         }
         if (functionName == "clearData") {
             helpString.emplace_back("void clearData(const std::string& target) ");
@@ -374,6 +1322,44 @@ std::vector<std::string> BlackBoardWrapper::help(const std::string& functionName
         if (functionName == "listTarget") {
             helpString.emplace_back("std::vector<std::string> listTarget() ");
         }
+        if (functionName == "listTargets") {
+            helpString.emplace_back("TargetPage listTargets(const std::string& prefix, const std::int32_t limit, const std::string& cursor) ");
+            helpString.emplace_back("The targets starting with <prefix>, in alphabetical order, at most <limit> at a time (all if zero or less). ");
+            helpString.emplace_back("<cursor> is empty for the first page, then the cursor of the previous page. ");
+        }
+        if (functionName == "scan") {
+            helpString.emplace_back("TargetPage scan(const std::string& prefix, const std::int32_t limit, const std::string& cursor) ");
+            helpString.emplace_back("As listTargets, also returning the content of each target. ");
+        }
+        if (functionName == "getMemoryStats") {
+            helpString.emplace_back("yarp::os::Property getMemoryStats() ");
+            helpString.emplace_back("Memory used by the blackboard, as (entries N) (bytes N) (max_bytes N) (evictions N) (expirations N). ");
+            helpString.emplace_back("max_bytes is 0 if there is no memory budget. bytes is an estimate, computed from the structure of the ");
+            helpString.emplace_back("values of the targets not in the initial values. ");
+        }
+        if (functionName == "findInRadius") {
+            helpString.emplace_back("std::vector<SpatialMatch> findInRadius(const std::string& mapId, const double x, const double y, const double z, const double radius) ");
+            helpString.emplace_back("Targets with a position on map <mapId> within <radius> of (x, y, z), the nearest first. ");
+            helpString.emplace_back("A target has a position if it contains either (pose (x y z)), with an optional (map_id name), ");
+            helpString.emplace_back("or (location (map_id name) (x x) (y y)), with an optional (z z). Positions without a map_id ");
+            helpString.emplace_back("are on map \"\". ");
+        }
+        if (functionName == "findNearest") {
+            helpString.emplace_back("std::vector<SpatialMatch> findNearest(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count) ");
+            helpString.emplace_back("The <count> targets with a position on map <mapId> nearest to (x, y, z), the nearest first. ");
+        }
+        if (functionName == "watch") {
+            helpString.emplace_back("bool watch(const std::string& pattern, const std::string& subscriber) ");
+            helpString.emplace_back("Publish the changes of the targets matching <pattern> on the updates:o port, for <subscriber>, ");
+            helpString.emplace_back("i.e. the name of the port it connected to updates:o. ");
+            helpString.emplace_back("<pattern> is either a target name or a prefix followed by '*'. Watching it again from the same ");
+            helpString.emplace_back("subscriber has no effect. The current content of the matching targets is published right away. ");
+        }
+        if (functionName == "unwatch") {
+            helpString.emplace_back("bool unwatch(const std::string& pattern, const std::string& subscriber) ");
+            helpString.emplace_back("Stop watching <pattern> for <subscriber>. The changes keep being published while other ");
+            helpString.emplace_back("subscribers watch it, or the same subscriber through another pattern. ");
+        }
         if (functionName == "help") {
             helpString.emplace_back("std::vector<std::string> help(const std::string& functionName = \"--all\")");
             helpString.emplace_back("Return list of available commands, or help message for a specific function");
@@ -409,13 +1395,37 @@ bool BlackBoardWrapper::read(yarp::os::ConnectionReader& connection)
                 reader.fail();
                 return false;
             }
-            BlackBoardWrapper_getData_helper::s_return_helper = getData(target);
+            BlackBoardWrapper_getData_helper::s_return_helper = getData(target);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BlackBoardWrapper_getData_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "getDataIfChanged") {
+            std::string target;
+            std::int64_t knownVersion;
+            if (!reader.readString(target)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readI64(knownVersion)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_getDataIfChanged_helper::s_return_helper = getDataIfChanged(target, knownVersion);
             yarp::os::idl::WireWriter writer(reader);
             if (!writer.isNull()) {
                 if (!writer.writeListHeader(1)) {
                     return false;
                 }
-                if (!writer.write(BlackBoardWrapper_getData_helper::s_return_helper)) {
+                if (!writer.write(BlackBoardWrapper_getDataIfChanged_helper::s_return_helper)) {
                     return false;
                 }
             }
@@ -424,7 +1434,7 @@ bool BlackBoardWrapper::read(yarp::os::ConnectionReader& connection)
         }
         if (tag == "setData") {
             std::string target;
-            yarp::os::Property datum;
+            yarp::BT_wrappers::PropertyEntries datum;
             if (!reader.readString(target)) {
                 reader.fail();
                 return false;
@@ -446,6 +1456,163 @@ bool BlackBoardWrapper::read(yarp::os::ConnectionReader& connection)
             reader.accept();
             return true;
         }
+        if (tag == "setDataWithTTL") {
+            std::string target;
+            yarp::BT_wrappers::PropertyEntries datum;
+            double ttl;
+            if (!reader.readString(target)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.read(datum)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(ttl)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_setDataWithTTL_helper::s_return_helper = setDataWithTTL(target, datum, ttl);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeBool(BlackBoardWrapper_setDataWithTTL_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "getField") {
+            std::string target;
+            std::string key;
+            if (!reader.readString(target)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readString(key)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_getField_helper::s_return_helper = getField(target, key);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BlackBoardWrapper_getField_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "setField") {
+            std::string target;
+            std::string key;
+            yarp::os::Value value;
+            if (!reader.readString(target)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readString(key)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.read(value)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_setField_helper::s_return_helper = setField(target, key, value);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeBool(BlackBoardWrapper_setField_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "getMany") {
+            std::vector<std::string> targets;
+            targets.clear();
+            uint32_t _size23;
+            yarp::os::idl::WireState _etype26;
+            reader.readListBegin(_etype26, _size23);
+            targets.resize(_size23);
+            for (auto& _elem27 : targets) {
+                if (!reader.readString(_elem27)) {
+                    reader.fail();
+                    return false;
+                }
+            }
+            reader.readListEnd();
+            BlackBoardWrapper_getMany_helper::s_return_helper = getMany(targets);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(BlackBoardWrapper_getMany_helper::s_return_helper.size()))) {
+                    return false;
+                }
+                for (const auto& _item28 : BlackBoardWrapper_getMany_helper::s_return_helper) {
+                    if (!writer.writeNested(_item28)) {
+                        return false;
+                    }
+                }
+                if (!writer.writeListEnd()) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "setMany") {
+            std::vector<std::string> targets;
+            std::vector<yarp::os::Property> data;
+            targets.clear();
+            uint32_t _size29;
+            yarp::os::idl::WireState _etype32;
+            reader.readListBegin(_etype32, _size29);
+            targets.resize(_size29);
+            for (auto& _elem33 : targets) {
+                if (!reader.readString(_elem33)) {
+                    reader.fail();
+                    return false;
+                }
+            }
+            reader.readListEnd();
+            data.clear();
+            uint32_t _size34;
+            yarp::os::idl::WireState _etype37;
+            reader.readListBegin(_etype37, _size34);
+            data.resize(_size34);
+            for (auto& _elem38 : data) {
+                if (!reader.readNested(_elem38)) {
+                    reader.fail();
+                    return false;
+                }
+            }
+            reader.readListEnd();
+            BlackBoardWrapper_setMany_helper::s_return_helper = setMany(targets, data);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeBool(BlackBoardWrapper_setMany_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
         if (tag == "clearData") {
             std::string target;
             if (!reader.readString(target)) {
@@ -494,8 +1661,174 @@ bool BlackBoardWrapper::read(yarp::os::ConnectionReader& connection)
                 if (!writer.writeListBegin(BOTTLE_TAG_STRING, static_cast<uint32_t>(BlackBoardWrapper_listTarget_helper::s_return_helper.size()))) {
                     return false;
                 }
-                for (const auto& _item5 : BlackBoardWrapper_listTarget_helper::s_return_helper) {
-                    if (!writer.writeString(_item5)) {
+                for (const auto& _item39 : BlackBoardWrapper_listTarget_helper::s_return_helper) {
+                    if (!writer.writeString(_item39)) {
+                        return false;
+                    }
+                }
+                if (!writer.writeListEnd()) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "listTargets") {
+            std::string prefix;
+            std::int32_t limit;
+            std::string cursor;
+            if (!reader.readString(prefix)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readI32(limit)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readString(cursor)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_listTargets_helper::s_return_helper = listTargets(prefix, limit, cursor);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BlackBoardWrapper_listTargets_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "scan") {
+            std::string prefix;
+            std::int32_t limit;
+            std::string cursor;
+            if (!reader.readString(prefix)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readI32(limit)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readString(cursor)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_scan_helper::s_return_helper = scan(prefix, limit, cursor);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BlackBoardWrapper_scan_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "getMemoryStats") {
+            BlackBoardWrapper_getMemoryStats_helper::s_return_helper = getMemoryStats();
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.write(BlackBoardWrapper_getMemoryStats_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "findInRadius") {
+            std::string mapId;
+            double x;
+            double y;
+            double z;
+            double radius;
+            if (!reader.readString(mapId)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(x)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(y)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(z)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(radius)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_findInRadius_helper::s_return_helper = findInRadius(mapId, x, y, z, radius);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(BlackBoardWrapper_findInRadius_helper::s_return_helper.size()))) {
+                    return false;
+                }
+                for (const auto& _item40 : BlackBoardWrapper_findInRadius_helper::s_return_helper) {
+                    if (!writer.writeNested(_item40)) {
+                        return false;
+                    }
+                }
+                if (!writer.writeListEnd()) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "findNearest") {
+            std::string mapId;
+            double x;
+            double y;
+            double z;
+            std::int32_t count;
+            if (!reader.readString(mapId)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(x)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(y)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readFloat64(z)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readI32(count)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_findNearest_helper::s_return_helper = findNearest(mapId, x, y, z, count);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(BlackBoardWrapper_findNearest_helper::s_return_helper.size()))) {
+                    return false;
+                }
+                for (const auto& _item41 : BlackBoardWrapper_findNearest_helper::s_return_helper) {
+                    if (!writer.writeNested(_item41)) {
                         return false;
                     }
                 }
@@ -506,6 +1839,54 @@ bool BlackBoardWrapper::read(yarp::os::ConnectionReader& connection)
             reader.accept();
             return true;
         }
+        if (tag == "watch") {
+            std::string pattern;
+            std::string subscriber;
+            if (!reader.readString(pattern)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readString(subscriber)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_watch_helper::s_return_helper = watch(pattern, subscriber);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeBool(BlackBoardWrapper_watch_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == "unwatch") {
+            std::string pattern;
+            std::string subscriber;
+            if (!reader.readString(pattern)) {
+                reader.fail();
+                return false;
+            }
+            if (!reader.readString(subscriber)) {
+                reader.fail();
+                return false;
+            }
+            BlackBoardWrapper_unwatch_helper::s_return_helper = unwatch(pattern, subscriber);
+            yarp::os::idl::WireWriter writer(reader);
+            if (!writer.isNull()) {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeBool(BlackBoardWrapper_unwatch_helper::s_return_helper)) {
+                    return false;
+                }
+            }
+            reader.accept();
+            return true;
+        }
         if (tag == "help") {
             std::string functionName;
             if (!reader.readString(functionName)) {
@@ -0,0 +1,735 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <yarp/BT_wrappers/DataUpdate.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Default constructor
+DataUpdate::DataUpdate() :
+        WirePortable(),
+        target(""),
+        version(0),
+        reset(false),
+        delta()
+{
+}
+
+// Constructor with field values
+DataUpdate::DataUpdate(const std::string& target,
+                       const std::int64_t version,
+                       const bool reset,
+                       const yarp::os::Property& delta) :
+        WirePortable(),
+        target(target),
+        version(version),
+        reset(reset),
+        delta(delta)
+{
+}
+
+// Read structure on a Wire
+bool DataUpdate::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_target(reader)) {
+        return false;
+    }
+    if (!read_version(reader)) {
+        return false;
+    }
+    if (!read_reset(reader)) {
+        return false;
+    }
+    if (!read_delta(reader)) {
+        return false;
+    }
+    return !reader.isError();
+}
+
+// Read structure on a Connection
+bool DataUpdate::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(4)) {
+        return false;
+    }
+    return read(reader);
+}
+
+// Write structure on a Wire
+bool DataUpdate::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_target(writer)) {
+        return false;
+    }
+    if (!write_version(writer)) {
+        return false;
+    }
+    if (!write_reset(writer)) {
+        return false;
+    }
+    if (!write_delta(writer)) {
+        return false;
+    }
+    return !writer.isError();
+}
+
+// Write structure on a Connection
+bool DataUpdate::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(4)) {
+        return false;
+    }
+    return write(writer);
+}
+
+// Convert to a printable string
+std::string DataUpdate::toString() const
+{
+    yarp::os::Bottle b;
+    b.read(*this);
+    return b.toString();
+}
+
+// Editor: default constructor
+DataUpdate::Editor::Editor()
+{
+    group = 0;
+    obj_owned = true;
+    obj = new DataUpdate;
+    dirty_flags(false);
+    yarp().setOwner(*this);
+}
+
+// Editor: constructor with base class
+DataUpdate::Editor::Editor(DataUpdate& obj)
+{
+    group = 0;
+    obj_owned = false;
+    edit(obj, false);
+    yarp().setOwner(*this);
+}
+
+// Editor: destructor
+DataUpdate::Editor::~Editor()
+{
+    if (obj_owned) {
+        delete obj;
+    }
+}
+
+// Editor: edit
+bool DataUpdate::Editor::edit(DataUpdate& obj, bool dirty)
+{
+    if (obj_owned) {
+        delete this->obj;
+    }
+    this->obj = &obj;
+    obj_owned = false;
+    dirty_flags(dirty);
+    return true;
+}
+
+// Editor: validity check
+bool DataUpdate::Editor::isValid() const
+{
+    return obj != nullptr;
+}
+
+// Editor: state
+DataUpdate& DataUpdate::Editor::state()
+{
+    return *obj;
+}
+
+// Editor: grouping begin
+void DataUpdate::Editor::start_editing()
+{
+    group++;
+}
+
+// Editor: grouping end
+void DataUpdate::Editor::stop_editing()
+{
+    group--;
+    if (group == 0 && is_dirty) {
+        communicate();
+    }
+}
+// Editor: target setter
+void DataUpdate::Editor::set_target(const std::string& target)
+{
+    will_set_target();
+    obj->target = target;
+    mark_dirty_target();
+    communicate();
+    did_set_target();
+}
+
+// Editor: target getter
+const std::string& DataUpdate::Editor::get_target() const
+{
+    return obj->target;
+}
+
+// Editor: target will_set
+bool DataUpdate::Editor::will_set_target()
+{
+    return true;
+}
+
+// Editor: target did_set
+bool DataUpdate::Editor::did_set_target()
+{
+    return true;
+}
+
+// Editor: version setter
+void DataUpdate::Editor::set_version(const std::int64_t version)
+{
+    will_set_version();
+    obj->version = version;
+    mark_dirty_version();
+    communicate();
+    did_set_version();
+}
+
+// Editor: version getter
+std::int64_t DataUpdate::Editor::get_version() const
+{
+    return obj->version;
+}
+
+// Editor: version will_set
+bool DataUpdate::Editor::will_set_version()
+{
+    return true;
+}
+
+// Editor: version did_set
+bool DataUpdate::Editor::did_set_version()
+{
+    return true;
+}
+
+// Editor: reset setter
+void DataUpdate::Editor::set_reset(const bool reset)
+{
+    will_set_reset();
+    obj->reset = reset;
+    mark_dirty_reset();
+    communicate();
+    did_set_reset();
+}
+
+// Editor: reset getter
+bool DataUpdate::Editor::get_reset() const
+{
+    return obj->reset;
+}
+
+// Editor: reset will_set
+bool DataUpdate::Editor::will_set_reset()
+{
+    return true;
+}
+
+// Editor: reset did_set
+bool DataUpdate::Editor::did_set_reset()
+{
+    return true;
+}
+
+// Editor: delta setter
+void DataUpdate::Editor::set_delta(const yarp::os::Property& delta)
+{
+    will_set_delta();
+    obj->delta = delta;
+    mark_dirty_delta();
+    communicate();
+    did_set_delta();
+}
+
+// Editor: delta getter
+const yarp::os::Property& DataUpdate::Editor::get_delta() const
+{
+    return obj->delta;
+}
+
+// Editor: delta will_set
+bool DataUpdate::Editor::will_set_delta()
+{
+    return true;
+}
+
+// Editor: delta did_set
+bool DataUpdate::Editor::did_set_delta()
+{
+    return true;
+}
+
+// Editor: clean
+void DataUpdate::Editor::clean()
+{
+    dirty_flags(false);
+}
+
+// Editor: read
+bool DataUpdate::Editor::read(yarp::os::ConnectionReader& connection)
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireReader reader(connection);
+    reader.expectAccept();
+    if (!reader.readListHeader()) {
+        return false;
+    }
+    int len = reader.getLength();
+    if (len == 0) {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(1)) {
+            return false;
+        }
+        writer.writeString("send: 'help' or 'patch (param1 val1) (param2 val2)'");
+        return true;
+    }
+    std::string tag;
+    if (!reader.readString(tag)) {
+        return false;
+    }
+    if (tag == "help") {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(2)) {
+            return false;
+        }
+        if (!writer.writeTag("many", 1, 0)) {
+            return false;
+        }
+        if (reader.getLength() > 0) {
+            std::string field;
+            if (!reader.readString(field)) {
+                return false;
+            }
+            if (field == "target") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::string target")) {
+                    return false;
+                }
+            }
+            if (field == "version") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::int64_t version")) {
+                    return false;
+                }
+            }
+            if (field == "reset") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("bool reset")) {
+                    return false;
+                }
+            }
+            if (field == "delta") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("yarp::os::Property delta")) {
+                    return false;
+                }
+            }
+        }
+        if (!writer.writeListHeader(5)) {
+            return false;
+        }
+        writer.writeString("*** Available fields:");
+        writer.writeString("target");
+        writer.writeString("version");
+        writer.writeString("reset");
+        writer.writeString("delta");
+        return true;
+    }
+    bool nested = true;
+    bool have_act = false;
+    if (tag != "patch") {
+        if (((len - 1) % 2) != 0) {
+            return false;
+        }
+        len = 1 + ((len - 1) / 2);
+        nested = false;
+        have_act = true;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (nested && !reader.readListHeader(3)) {
+            return false;
+        }
+        std::string act;
+        std::string key;
+        if (have_act) {
+            act = tag;
+        } else if (!reader.readString(act)) {
+            return false;
+        }
+        if (!reader.readString(key)) {
+            return false;
+        }
+        if (key == "target") {
+            will_set_target();
+            if (!obj->nested_read_target(reader)) {
+                return false;
+            }
+            did_set_target();
+        } else if (key == "version") {
+            will_set_version();
+            if (!obj->nested_read_version(reader)) {
+                return false;
+            }
+            did_set_version();
+        } else if (key == "reset") {
+            will_set_reset();
+            if (!obj->nested_read_reset(reader)) {
+                return false;
+            }
+            did_set_reset();
+        } else if (key == "delta") {
+            will_set_delta();
+            if (!obj->nested_read_delta(reader)) {
+                return false;
+            }
+            did_set_delta();
+        } else {
+            // would be useful to have a fallback here
+        }
+    }
+    reader.accept();
+    yarp::os::idl::WireWriter writer(reader);
+    if (writer.isNull()) {
+        return true;
+    }
+    writer.writeListHeader(1);
+    writer.writeVocab(yarp::os::createVocab('o', 'k'));
+    return true;
+}
+
+// Editor: write
+bool DataUpdate::Editor::write(yarp::os::ConnectionWriter& connection) const
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(dirty_count + 1)) {
+        return false;
+    }
+    if (!writer.writeString("patch")) {
+        return false;
+    }
+    if (is_dirty_target) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("target")) {
+            return false;
+        }
+        if (!obj->nested_write_target(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_version) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("version")) {
+            return false;
+        }
+        if (!obj->nested_write_version(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_reset) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("reset")) {
+            return false;
+        }
+        if (!obj->nested_write_reset(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_delta) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("delta")) {
+            return false;
+        }
+        if (!obj->nested_write_delta(writer)) {
+            return false;
+        }
+    }
+    return !writer.isError();
+}
+
+// Editor: send if possible
+void DataUpdate::Editor::communicate()
+{
+    if (group != 0) {
+        return;
+    }
+    if (yarp().canWrite()) {
+        yarp().write(*this);
+        clean();
+    }
+}
+
+// Editor: mark dirty overall
+void DataUpdate::Editor::mark_dirty()
+{
+    is_dirty = true;
+}
+
+// Editor: target mark_dirty
+void DataUpdate::Editor::mark_dirty_target()
+{
+    if (is_dirty_target) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_target = true;
+    mark_dirty();
+}
+
+// Editor: version mark_dirty
+void DataUpdate::Editor::mark_dirty_version()
+{
+    if (is_dirty_version) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_version = true;
+    mark_dirty();
+}
+
+// Editor: reset mark_dirty
+void DataUpdate::Editor::mark_dirty_reset()
+{
+    if (is_dirty_reset) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_reset = true;
+    mark_dirty();
+}
+
+// Editor: delta mark_dirty
+void DataUpdate::Editor::mark_dirty_delta()
+{
+    if (is_dirty_delta) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_delta = true;
+    mark_dirty();
+}
+
+// Editor: dirty_flags
+void DataUpdate::Editor::dirty_flags(bool flag)
+{
+    is_dirty = flag;
+    is_dirty_target = flag;
+    is_dirty_version = flag;
+    is_dirty_reset = flag;
+    is_dirty_delta = flag;
+    dirty_count = flag ? 4 : 0;
+}
+
+// read target field
+bool DataUpdate::read_target(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readString(target)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write target field
+bool DataUpdate::write_target(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(target)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) target field
+bool DataUpdate::nested_read_target(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readString(target)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) target field
+bool DataUpdate::nested_write_target(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(target)) {
+        return false;
+    }
+    return true;
+}
+
+// read version field
+bool DataUpdate::read_version(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI64(version)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write version field
+bool DataUpdate::write_version(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(version)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) version field
+bool DataUpdate::nested_read_version(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI64(version)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) version field
+bool DataUpdate::nested_write_version(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(version)) {
+        return false;
+    }
+    return true;
+}
+
+// read reset field
+bool DataUpdate::read_reset(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(reset)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write reset field
+bool DataUpdate::write_reset(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(reset)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) reset field
+bool DataUpdate::nested_read_reset(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(reset)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) reset field
+bool DataUpdate::nested_write_reset(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(reset)) {
+        return false;
+    }
+    return true;
+}
+
+// read delta field
+bool DataUpdate::read_delta(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.read(delta)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write delta field
+bool DataUpdate::write_delta(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.write(delta)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) delta field
+bool DataUpdate::nested_read_delta(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readNested(delta)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) delta field
+bool DataUpdate::nested_write_delta(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeNested(delta)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace yarp
+} // namespace BT_wrappers
@@ -0,0 +1,619 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <yarp/BT_wrappers/SpatialMatch.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Default constructor
+SpatialMatch::SpatialMatch() :
+        WirePortable(),
+        target(""),
+        distance(0.0),
+        data()
+{
+}
+
+// Constructor with field values
+SpatialMatch::SpatialMatch(const std::string& target,
+                           const double distance,
+                           const yarp::os::Property& data) :
+        WirePortable(),
+        target(target),
+        distance(distance),
+        data(data)
+{
+}
+
+// Read structure on a Wire
+bool SpatialMatch::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_target(reader)) {
+        return false;
+    }
+    if (!read_distance(reader)) {
+        return false;
+    }
+    if (!read_data(reader)) {
+        return false;
+    }
+    return !reader.isError();
+}
+
+// Read structure on a Connection
+bool SpatialMatch::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(3)) {
+        return false;
+    }
+    return read(reader);
+}
+
+// Write structure on a Wire
+bool SpatialMatch::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_target(writer)) {
+        return false;
+    }
+    if (!write_distance(writer)) {
+        return false;
+    }
+    if (!write_data(writer)) {
+        return false;
+    }
+    return !writer.isError();
+}
+
+// Write structure on a Connection
+bool SpatialMatch::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    return write(writer);
+}
+
+// Convert to a printable string
+std::string SpatialMatch::toString() const
+{
+    yarp::os::Bottle b;
+    b.read(*this);
+    return b.toString();
+}
+
+// Editor: default constructor
+SpatialMatch::Editor::Editor()
+{
+    group = 0;
+    obj_owned = true;
+    obj = new SpatialMatch;
+    dirty_flags(false);
+    yarp().setOwner(*this);
+}
+
+// Editor: constructor with base class
+SpatialMatch::Editor::Editor(SpatialMatch& obj)
+{
+    group = 0;
+    obj_owned = false;
+    edit(obj, false);
+    yarp().setOwner(*this);
+}
+
+// Editor: destructor
+SpatialMatch::Editor::~Editor()
+{
+    if (obj_owned) {
+        delete obj;
+    }
+}
+
+// Editor: edit
+bool SpatialMatch::Editor::edit(SpatialMatch& obj, bool dirty)
+{
+    if (obj_owned) {
+        delete this->obj;
+    }
+    this->obj = &obj;
+    obj_owned = false;
+    dirty_flags(dirty);
+    return true;
+}
+
+// Editor: validity check
+bool SpatialMatch::Editor::isValid() const
+{
+    return obj != nullptr;
+}
+
+// Editor: state
+SpatialMatch& SpatialMatch::Editor::state()
+{
+    return *obj;
+}
+
+// Editor: grouping begin
+void SpatialMatch::Editor::start_editing()
+{
+    group++;
+}
+
+// Editor: grouping end
+void SpatialMatch::Editor::stop_editing()
+{
+    group--;
+    if (group == 0 && is_dirty) {
+        communicate();
+    }
+}
+// Editor: target setter
+void SpatialMatch::Editor::set_target(const std::string& target)
+{
+    will_set_target();
+    obj->target = target;
+    mark_dirty_target();
+    communicate();
+    did_set_target();
+}
+
+// Editor: target getter
+const std::string& SpatialMatch::Editor::get_target() const
+{
+    return obj->target;
+}
+
+// Editor: target will_set
+bool SpatialMatch::Editor::will_set_target()
+{
+    return true;
+}
+
+// Editor: target did_set
+bool SpatialMatch::Editor::did_set_target()
+{
+    return true;
+}
+
+// Editor: distance setter
+void SpatialMatch::Editor::set_distance(const double distance)
+{
+    will_set_distance();
+    obj->distance = distance;
+    mark_dirty_distance();
+    communicate();
+    did_set_distance();
+}
+
+// Editor: distance getter
+double SpatialMatch::Editor::get_distance() const
+{
+    return obj->distance;
+}
+
+// Editor: distance will_set
+bool SpatialMatch::Editor::will_set_distance()
+{
+    return true;
+}
+
+// Editor: distance did_set
+bool SpatialMatch::Editor::did_set_distance()
+{
+    return true;
+}
+
+// Editor: data setter
+void SpatialMatch::Editor::set_data(const yarp::os::Property& data)
+{
+    will_set_data();
+    obj->data = data;
+    mark_dirty_data();
+    communicate();
+    did_set_data();
+}
+
+// Editor: data getter
+const yarp::os::Property& SpatialMatch::Editor::get_data() const
+{
+    return obj->data;
+}
+
+// Editor: data will_set
+bool SpatialMatch::Editor::will_set_data()
+{
+    return true;
+}
+
+// Editor: data did_set
+bool SpatialMatch::Editor::did_set_data()
+{
+    return true;
+}
+
+// Editor: clean
+void SpatialMatch::Editor::clean()
+{
+    dirty_flags(false);
+}
+
+// Editor: read
+bool SpatialMatch::Editor::read(yarp::os::ConnectionReader& connection)
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireReader reader(connection);
+    reader.expectAccept();
+    if (!reader.readListHeader()) {
+        return false;
+    }
+    int len = reader.getLength();
+    if (len == 0) {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(1)) {
+            return false;
+        }
+        writer.writeString("send: 'help' or 'patch (param1 val1) (param2 val2)'");
+        return true;
+    }
+    std::string tag;
+    if (!reader.readString(tag)) {
+        return false;
+    }
+    if (tag == "help") {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(2)) {
+            return false;
+        }
+        if (!writer.writeTag("many", 1, 0)) {
+            return false;
+        }
+        if (reader.getLength() > 0) {
+            std::string field;
+            if (!reader.readString(field)) {
+                return false;
+            }
+            if (field == "target") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::string target")) {
+                    return false;
+                }
+            }
+            if (field == "distance") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("double distance")) {
+                    return false;
+                }
+            }
+            if (field == "data") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("yarp::os::Property data")) {
+                    return false;
+                }
+            }
+        }
+        if (!writer.writeListHeader(4)) {
+            return false;
+        }
+        writer.writeString("*** Available fields:");
+        writer.writeString("target");
+        writer.writeString("distance");
+        writer.writeString("data");
+        return true;
+    }
+    bool nested = true;
+    bool have_act = false;
+    if (tag != "patch") {
+        if (((len - 1) % 2) != 0) {
+            return false;
+        }
+        len = 1 + ((len - 1) / 2);
+        nested = false;
+        have_act = true;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (nested && !reader.readListHeader(3)) {
+            return false;
+        }
+        std::string act;
+        std::string key;
+        if (have_act) {
+            act = tag;
+        } else if (!reader.readString(act)) {
+            return false;
+        }
+        if (!reader.readString(key)) {
+            return false;
+        }
+        if (key == "target") {
+            will_set_target();
+            if (!obj->nested_read_target(reader)) {
+                return false;
+            }
+            did_set_target();
+        } else if (key == "distance") {
+            will_set_distance();
+            if (!obj->nested_read_distance(reader)) {
+                return false;
+            }
+            did_set_distance();
+        } else if (key == "data") {
+            will_set_data();
+            if (!obj->nested_read_data(reader)) {
+                return false;
+            }
+            did_set_data();
+        } else {
+            // would be useful to have a fallback here
+        }
+    }
+    reader.accept();
+    yarp::os::idl::WireWriter writer(reader);
+    if (writer.isNull()) {
+        return true;
+    }
+    writer.writeListHeader(1);
+    writer.writeVocab(yarp::os::createVocab('o', 'k'));
+    return true;
+}
+
+// Editor: write
+bool SpatialMatch::Editor::write(yarp::os::ConnectionWriter& connection) const
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(dirty_count + 1)) {
+        return false;
+    }
+    if (!writer.writeString("patch")) {
+        return false;
+    }
+    if (is_dirty_target) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("target")) {
+            return false;
+        }
+        if (!obj->nested_write_target(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_distance) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("distance")) {
+            return false;
+        }
+        if (!obj->nested_write_distance(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_data) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("data")) {
+            return false;
+        }
+        if (!obj->nested_write_data(writer)) {
+            return false;
+        }
+    }
+    return !writer.isError();
+}
+
+// Editor: send if possible
+void SpatialMatch::Editor::communicate()
+{
+    if (group != 0) {
+        return;
+    }
+    if (yarp().canWrite()) {
+        yarp().write(*this);
+        clean();
+    }
+}
+
+// Editor: mark dirty overall
+void SpatialMatch::Editor::mark_dirty()
+{
+    is_dirty = true;
+}
+
+// Editor: target mark_dirty
+void SpatialMatch::Editor::mark_dirty_target()
+{
+    if (is_dirty_target) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_target = true;
+    mark_dirty();
+}
+
+// Editor: distance mark_dirty
+void SpatialMatch::Editor::mark_dirty_distance()
+{
+    if (is_dirty_distance) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_distance = true;
+    mark_dirty();
+}
+
+// Editor: data mark_dirty
+void SpatialMatch::Editor::mark_dirty_data()
+{
+    if (is_dirty_data) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_data = true;
+    mark_dirty();
+}
+
+// Editor: dirty_flags
+void SpatialMatch::Editor::dirty_flags(bool flag)
+{
+    is_dirty = flag;
+    is_dirty_target = flag;
+    is_dirty_distance = flag;
+    is_dirty_data = flag;
+    dirty_count = flag ? 3 : 0;
+}
+
+// read target field
+bool SpatialMatch::read_target(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readString(target)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write target field
+bool SpatialMatch::write_target(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(target)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) target field
+bool SpatialMatch::nested_read_target(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readString(target)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) target field
+bool SpatialMatch::nested_write_target(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(target)) {
+        return false;
+    }
+    return true;
+}
+
+// read distance field
+bool SpatialMatch::read_distance(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readFloat64(distance)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write distance field
+bool SpatialMatch::write_distance(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeFloat64(distance)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) distance field
+bool SpatialMatch::nested_read_distance(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readFloat64(distance)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) distance field
+bool SpatialMatch::nested_write_distance(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeFloat64(distance)) {
+        return false;
+    }
+    return true;
+}
+
+// read data field
+bool SpatialMatch::read_data(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.read(data)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write data field
+bool SpatialMatch::write_data(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.write(data)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) data field
+bool SpatialMatch::nested_read_data(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readNested(data)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) data field
+bool SpatialMatch::nested_write_data(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeNested(data)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace yarp
+} // namespace BT_wrappers
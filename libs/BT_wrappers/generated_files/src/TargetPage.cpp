@@ -0,0 +1,683 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <yarp/BT_wrappers/TargetPage.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Default constructor
+TargetPage::TargetPage() :
+        WirePortable(),
+        targets(),
+        data(),
+        cursor("")
+{
+}
+
+// Constructor with field values
+TargetPage::TargetPage(const std::vector<std::string>& targets,
+                       const std::vector<yarp::os::Property>& data,
+                       const std::string& cursor) :
+        WirePortable(),
+        targets(targets),
+        data(data),
+        cursor(cursor)
+{
+}
+
+// Read structure on a Wire
+bool TargetPage::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_targets(reader)) {
+        return false;
+    }
+    if (!read_data(reader)) {
+        return false;
+    }
+    if (!read_cursor(reader)) {
+        return false;
+    }
+    return !reader.isError();
+}
+
+// Read structure on a Connection
+bool TargetPage::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(3)) {
+        return false;
+    }
+    return read(reader);
+}
+
+// Write structure on a Wire
+bool TargetPage::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_targets(writer)) {
+        return false;
+    }
+    if (!write_data(writer)) {
+        return false;
+    }
+    if (!write_cursor(writer)) {
+        return false;
+    }
+    return !writer.isError();
+}
+
+// Write structure on a Connection
+bool TargetPage::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    return write(writer);
+}
+
+// Convert to a printable string
+std::string TargetPage::toString() const
+{
+    yarp::os::Bottle b;
+    b.read(*this);
+    return b.toString();
+}
+
+// Editor: default constructor
+TargetPage::Editor::Editor()
+{
+    group = 0;
+    obj_owned = true;
+    obj = new TargetPage;
+    dirty_flags(false);
+    yarp().setOwner(*this);
+}
+
+// Editor: constructor with base class
+TargetPage::Editor::Editor(TargetPage& obj)
+{
+    group = 0;
+    obj_owned = false;
+    edit(obj, false);
+    yarp().setOwner(*this);
+}
+
+// Editor: destructor
+TargetPage::Editor::~Editor()
+{
+    if (obj_owned) {
+        delete obj;
+    }
+}
+
+// Editor: edit
+bool TargetPage::Editor::edit(TargetPage& obj, bool dirty)
+{
+    if (obj_owned) {
+        delete this->obj;
+    }
+    this->obj = &obj;
+    obj_owned = false;
+    dirty_flags(dirty);
+    return true;
+}
+
+// Editor: validity check
+bool TargetPage::Editor::isValid() const
+{
+    return obj != nullptr;
+}
+
+// Editor: state
+TargetPage& TargetPage::Editor::state()
+{
+    return *obj;
+}
+
+// Editor: grouping begin
+void TargetPage::Editor::start_editing()
+{
+    group++;
+}
+
+// Editor: grouping end
+void TargetPage::Editor::stop_editing()
+{
+    group--;
+    if (group == 0 && is_dirty) {
+        communicate();
+    }
+}
+// Editor: targets setter
+void TargetPage::Editor::set_targets(const std::vector<std::string>& targets)
+{
+    will_set_targets();
+    obj->targets = targets;
+    mark_dirty_targets();
+    communicate();
+    did_set_targets();
+}
+
+// Editor: targets getter
+const std::vector<std::string>& TargetPage::Editor::get_targets() const
+{
+    return obj->targets;
+}
+
+// Editor: targets will_set
+bool TargetPage::Editor::will_set_targets()
+{
+    return true;
+}
+
+// Editor: targets did_set
+bool TargetPage::Editor::did_set_targets()
+{
+    return true;
+}
+
+// Editor: data setter
+void TargetPage::Editor::set_data(const std::vector<yarp::os::Property>& data)
+{
+    will_set_data();
+    obj->data = data;
+    mark_dirty_data();
+    communicate();
+    did_set_data();
+}
+
+// Editor: data getter
+const std::vector<yarp::os::Property>& TargetPage::Editor::get_data() const
+{
+    return obj->data;
+}
+
+// Editor: data will_set
+bool TargetPage::Editor::will_set_data()
+{
+    return true;
+}
+
+// Editor: data did_set
+bool TargetPage::Editor::did_set_data()
+{
+    return true;
+}
+
+// Editor: cursor setter
+void TargetPage::Editor::set_cursor(const std::string& cursor)
+{
+    will_set_cursor();
+    obj->cursor = cursor;
+    mark_dirty_cursor();
+    communicate();
+    did_set_cursor();
+}
+
+// Editor: cursor getter
+const std::string& TargetPage::Editor::get_cursor() const
+{
+    return obj->cursor;
+}
+
+// Editor: cursor will_set
+bool TargetPage::Editor::will_set_cursor()
+{
+    return true;
+}
+
+// Editor: cursor did_set
+bool TargetPage::Editor::did_set_cursor()
+{
+    return true;
+}
+
+// Editor: clean
+void TargetPage::Editor::clean()
+{
+    dirty_flags(false);
+}
+
+// Editor: read
+bool TargetPage::Editor::read(yarp::os::ConnectionReader& connection)
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireReader reader(connection);
+    reader.expectAccept();
+    if (!reader.readListHeader()) {
+        return false;
+    }
+    int len = reader.getLength();
+    if (len == 0) {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(1)) {
+            return false;
+        }
+        writer.writeString("send: 'help' or 'patch (param1 val1) (param2 val2)'");
+        return true;
+    }
+    std::string tag;
+    if (!reader.readString(tag)) {
+        return false;
+    }
+    if (tag == "help") {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(2)) {
+            return false;
+        }
+        if (!writer.writeTag("many", 1, 0)) {
+            return false;
+        }
+        if (reader.getLength() > 0) {
+            std::string field;
+            if (!reader.readString(field)) {
+                return false;
+            }
+            if (field == "targets") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::vector<std::string> targets")) {
+                    return false;
+                }
+            }
+            if (field == "data") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::vector<yarp::os::Property> data")) {
+                    return false;
+                }
+            }
+            if (field == "cursor") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::string cursor")) {
+                    return false;
+                }
+            }
+        }
+        if (!writer.writeListHeader(4)) {
+            return false;
+        }
+        writer.writeString("*** Available fields:");
+        writer.writeString("targets");
+        writer.writeString("data");
+        writer.writeString("cursor");
+        return true;
+    }
+    bool nested = true;
+    bool have_act = false;
+    if (tag != "patch") {
+        if (((len - 1) % 2) != 0) {
+            return false;
+        }
+        len = 1 + ((len - 1) / 2);
+        nested = false;
+        have_act = true;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (nested && !reader.readListHeader(3)) {
+            return false;
+        }
+        std::string act;
+        std::string key;
+        if (have_act) {
+            act = tag;
+        } else if (!reader.readString(act)) {
+            return false;
+        }
+        if (!reader.readString(key)) {
+            return false;
+        }
+        if (key == "targets") {
+            will_set_targets();
+            if (!obj->nested_read_targets(reader)) {
+                return false;
+            }
+            did_set_targets();
+        } else if (key == "data") {
+            will_set_data();
+            if (!obj->nested_read_data(reader)) {
+                return false;
+            }
+            did_set_data();
+        } else if (key == "cursor") {
+            will_set_cursor();
+            if (!obj->nested_read_cursor(reader)) {
+                return false;
+            }
+            did_set_cursor();
+        } else {
+            // would be useful to have a fallback here
+        }
+    }
+    reader.accept();
+    yarp::os::idl::WireWriter writer(reader);
+    if (writer.isNull()) {
+        return true;
+    }
+    writer.writeListHeader(1);
+    writer.writeVocab(yarp::os::createVocab('o', 'k'));
+    return true;
+}
+
+// Editor: write
+bool TargetPage::Editor::write(yarp::os::ConnectionWriter& connection) const
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(dirty_count + 1)) {
+        return false;
+    }
+    if (!writer.writeString("patch")) {
+        return false;
+    }
+    if (is_dirty_targets) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("targets")) {
+            return false;
+        }
+        if (!obj->nested_write_targets(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_data) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("data")) {
+            return false;
+        }
+        if (!obj->nested_write_data(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_cursor) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("cursor")) {
+            return false;
+        }
+        if (!obj->nested_write_cursor(writer)) {
+            return false;
+        }
+    }
+    return !writer.isError();
+}
+
+// Editor: send if possible
+void TargetPage::Editor::communicate()
+{
+    if (group != 0) {
+        return;
+    }
+    if (yarp().canWrite()) {
+        yarp().write(*this);
+        clean();
+    }
+}
+
+// Editor: mark dirty overall
+void TargetPage::Editor::mark_dirty()
+{
+    is_dirty = true;
+}
+
+// Editor: targets mark_dirty
+void TargetPage::Editor::mark_dirty_targets()
+{
+    if (is_dirty_targets) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_targets = true;
+    mark_dirty();
+}
+
+// Editor: data mark_dirty
+void TargetPage::Editor::mark_dirty_data()
+{
+    if (is_dirty_data) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_data = true;
+    mark_dirty();
+}
+
+// Editor: cursor mark_dirty
+void TargetPage::Editor::mark_dirty_cursor()
+{
+    if (is_dirty_cursor) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_cursor = true;
+    mark_dirty();
+}
+
+// Editor: dirty_flags
+void TargetPage::Editor::dirty_flags(bool flag)
+{
+    is_dirty = flag;
+    is_dirty_targets = flag;
+    is_dirty_data = flag;
+    is_dirty_cursor = flag;
+    dirty_count = flag ? 3 : 0;
+}
+
+// read targets field
+bool TargetPage::read_targets(yarp::os::idl::WireReader& reader)
+{
+    targets.clear();
+    uint32_t _size0;
+    yarp::os::idl::WireState _etype3;
+    reader.readListBegin(_etype3, _size0);
+    targets.resize(_size0);
+    for (auto& _elem4 : targets) {
+        if (!reader.readString(_elem4)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write targets field
+bool TargetPage::write_targets(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_STRING, static_cast<uint32_t>(targets.size()))) {
+        return false;
+    }
+    for (const auto& _item5 : targets) {
+        if (!writer.writeString(_item5)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) targets field
+bool TargetPage::nested_read_targets(yarp::os::idl::WireReader& reader)
+{
+    targets.clear();
+    uint32_t _size6;
+    yarp::os::idl::WireState _etype9;
+    reader.readListBegin(_etype9, _size6);
+    targets.resize(_size6);
+    for (auto& _elem10 : targets) {
+        if (!reader.readString(_elem10)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write (nested) targets field
+bool TargetPage::nested_write_targets(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_STRING, static_cast<uint32_t>(targets.size()))) {
+        return false;
+    }
+    for (const auto& _item11 : targets) {
+        if (!writer.writeString(_item11)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read data field
+bool TargetPage::read_data(yarp::os::idl::WireReader& reader)
+{
+    data.clear();
+    uint32_t _size12;
+    yarp::os::idl::WireState _etype15;
+    reader.readListBegin(_etype15, _size12);
+    data.resize(_size12);
+    for (auto& _elem16 : data) {
+        if (!reader.readNested(_elem16)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write data field
+bool TargetPage::write_data(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(data.size()))) {
+        return false;
+    }
+    for (const auto& _item17 : data) {
+        if (!writer.writeNested(_item17)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) data field
+bool TargetPage::nested_read_data(yarp::os::idl::WireReader& reader)
+{
+    data.clear();
+    uint32_t _size18;
+    yarp::os::idl::WireState _etype21;
+    reader.readListBegin(_etype21, _size18);
+    data.resize(_size18);
+    for (auto& _elem22 : data) {
+        if (!reader.readNested(_elem22)) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write (nested) data field
+bool TargetPage::nested_write_data(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, static_cast<uint32_t>(data.size()))) {
+        return false;
+    }
+    for (const auto& _item23 : data) {
+        if (!writer.writeNested(_item23)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read cursor field
+bool TargetPage::read_cursor(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readString(cursor)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write cursor field
+bool TargetPage::write_cursor(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(cursor)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) cursor field
+bool TargetPage::nested_read_cursor(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readString(cursor)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) cursor field
+bool TargetPage::nested_write_cursor(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(cursor)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace yarp
+} // namespace BT_wrappers
@@ -0,0 +1,511 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <yarp/BT_wrappers/TickReply.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Default constructor
+TickReply::TickReply() :
+        WirePortable(),
+        status((ReturnStatus)0),
+        params_needed(false)
+{
+}
+
+// Constructor with field values
+TickReply::TickReply(const ReturnStatus status,
+                     const bool params_needed) :
+        WirePortable(),
+        status(status),
+        params_needed(params_needed)
+{
+}
+
+// Read structure on a Wire
+bool TickReply::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_status(reader)) {
+        return false;
+    }
+    if (!read_params_needed(reader)) {
+        return false;
+    }
+    return !reader.isError();
+}
+
+// Read structure on a Connection
+bool TickReply::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(2)) {
+        return false;
+    }
+    return read(reader);
+}
+
+// Write structure on a Wire
+bool TickReply::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_status(writer)) {
+        return false;
+    }
+    if (!write_params_needed(writer)) {
+        return false;
+    }
+    return !writer.isError();
+}
+
+// Write structure on a Connection
+bool TickReply::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(2)) {
+        return false;
+    }
+    return write(writer);
+}
+
+// Convert to a printable string
+std::string TickReply::toString() const
+{
+    yarp::os::Bottle b;
+    b.read(*this);
+    return b.toString();
+}
+
+// Editor: default constructor
+TickReply::Editor::Editor()
+{
+    group = 0;
+    obj_owned = true;
+    obj = new TickReply;
+    dirty_flags(false);
+    yarp().setOwner(*this);
+}
+
+// Editor: constructor with base class
+TickReply::Editor::Editor(TickReply& obj)
+{
+    group = 0;
+    obj_owned = false;
+    edit(obj, false);
+    yarp().setOwner(*this);
+}
+
+// Editor: destructor
+TickReply::Editor::~Editor()
+{
+    if (obj_owned) {
+        delete obj;
+    }
+}
+
+// Editor: edit
+bool TickReply::Editor::edit(TickReply& obj, bool dirty)
+{
+    if (obj_owned) {
+        delete this->obj;
+    }
+    this->obj = &obj;
+    obj_owned = false;
+    dirty_flags(dirty);
+    return true;
+}
+
+// Editor: validity check
+bool TickReply::Editor::isValid() const
+{
+    return obj != nullptr;
+}
+
+// Editor: state
+TickReply& TickReply::Editor::state()
+{
+    return *obj;
+}
+
+// Editor: grouping begin
+void TickReply::Editor::start_editing()
+{
+    group++;
+}
+
+// Editor: grouping end
+void TickReply::Editor::stop_editing()
+{
+    group--;
+    if (group == 0 && is_dirty) {
+        communicate();
+    }
+}
+// Editor: status setter
+void TickReply::Editor::set_status(const ReturnStatus status)
+{
+    will_set_status();
+    obj->status = status;
+    mark_dirty_status();
+    communicate();
+    did_set_status();
+}
+
+// Editor: status getter
+ReturnStatus TickReply::Editor::get_status() const
+{
+    return obj->status;
+}
+
+// Editor: status will_set
+bool TickReply::Editor::will_set_status()
+{
+    return true;
+}
+
+// Editor: status did_set
+bool TickReply::Editor::did_set_status()
+{
+    return true;
+}
+
+// Editor: params_needed setter
+void TickReply::Editor::set_params_needed(const bool params_needed)
+{
+    will_set_params_needed();
+    obj->params_needed = params_needed;
+    mark_dirty_params_needed();
+    communicate();
+    did_set_params_needed();
+}
+
+// Editor: params_needed getter
+bool TickReply::Editor::get_params_needed() const
+{
+    return obj->params_needed;
+}
+
+// Editor: params_needed will_set
+bool TickReply::Editor::will_set_params_needed()
+{
+    return true;
+}
+
+// Editor: params_needed did_set
+bool TickReply::Editor::did_set_params_needed()
+{
+    return true;
+}
+
+// Editor: clean
+void TickReply::Editor::clean()
+{
+    dirty_flags(false);
+}
+
+// Editor: read
+bool TickReply::Editor::read(yarp::os::ConnectionReader& connection)
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireReader reader(connection);
+    reader.expectAccept();
+    if (!reader.readListHeader()) {
+        return false;
+    }
+    int len = reader.getLength();
+    if (len == 0) {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(1)) {
+            return false;
+        }
+        writer.writeString("send: 'help' or 'patch (param1 val1) (param2 val2)'");
+        return true;
+    }
+    std::string tag;
+    if (!reader.readString(tag)) {
+        return false;
+    }
+    if (tag == "help") {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(2)) {
+            return false;
+        }
+        if (!writer.writeTag("many", 1, 0)) {
+            return false;
+        }
+        if (reader.getLength() > 0) {
+            std::string field;
+            if (!reader.readString(field)) {
+                return false;
+            }
+            if (field == "status") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("ReturnStatus status")) {
+                    return false;
+                }
+            }
+            if (field == "params_needed") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("bool params_needed")) {
+                    return false;
+                }
+            }
+        }
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        writer.writeString("*** Available fields:");
+        writer.writeString("status");
+        writer.writeString("params_needed");
+        return true;
+    }
+    bool nested = true;
+    bool have_act = false;
+    if (tag != "patch") {
+        if (((len - 1) % 2) != 0) {
+            return false;
+        }
+        len = 1 + ((len - 1) / 2);
+        nested = false;
+        have_act = true;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (nested && !reader.readListHeader(3)) {
+            return false;
+        }
+        std::string act;
+        std::string key;
+        if (have_act) {
+            act = tag;
+        } else if (!reader.readString(act)) {
+            return false;
+        }
+        if (!reader.readString(key)) {
+            return false;
+        }
+        if (key == "status") {
+            will_set_status();
+            if (!obj->nested_read_status(reader)) {
+                return false;
+            }
+            did_set_status();
+        } else if (key == "params_needed") {
+            will_set_params_needed();
+            if (!obj->nested_read_params_needed(reader)) {
+                return false;
+            }
+            did_set_params_needed();
+        } else {
+            // would be useful to have a fallback here
+        }
+    }
+    reader.accept();
+    yarp::os::idl::WireWriter writer(reader);
+    if (writer.isNull()) {
+        return true;
+    }
+    writer.writeListHeader(1);
+    writer.writeVocab(yarp::os::createVocab('o', 'k'));
+    return true;
+}
+
+// Editor: write
+bool TickReply::Editor::write(yarp::os::ConnectionWriter& connection) const
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(dirty_count + 1)) {
+        return false;
+    }
+    if (!writer.writeString("patch")) {
+        return false;
+    }
+    if (is_dirty_status) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("status")) {
+            return false;
+        }
+        if (!obj->nested_write_status(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_params_needed) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("params_needed")) {
+            return false;
+        }
+        if (!obj->nested_write_params_needed(writer)) {
+            return false;
+        }
+    }
+    return !writer.isError();
+}
+
+// Editor: send if possible
+void TickReply::Editor::communicate()
+{
+    if (group != 0) {
+        return;
+    }
+    if (yarp().canWrite()) {
+        yarp().write(*this);
+        clean();
+    }
+}
+
+// Editor: mark dirty overall
+void TickReply::Editor::mark_dirty()
+{
+    is_dirty = true;
+}
+
+// Editor: status mark_dirty
+void TickReply::Editor::mark_dirty_status()
+{
+    if (is_dirty_status) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_status = true;
+    mark_dirty();
+}
+
+// Editor: params_needed mark_dirty
+void TickReply::Editor::mark_dirty_params_needed()
+{
+    if (is_dirty_params_needed) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_params_needed = true;
+    mark_dirty();
+}
+
+// Editor: dirty_flags
+void TickReply::Editor::dirty_flags(bool flag)
+{
+    is_dirty = flag;
+    is_dirty_status = flag;
+    is_dirty_params_needed = flag;
+    dirty_count = flag ? 2 : 0;
+}
+
+// read status field
+bool TickReply::read_status(yarp::os::idl::WireReader& reader)
+{
+    int32_t ecast0;
+    ReturnStatusVocab cvrt1;
+    if (!reader.readEnum(ecast0, cvrt1)) {
+        reader.fail();
+        return false;
+    } else {
+        status = static_cast<ReturnStatus>(ecast0);
+    }
+    return true;
+}
+
+// write status field
+bool TickReply::write_status(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(static_cast<int32_t>(status))) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) status field
+bool TickReply::nested_read_status(yarp::os::idl::WireReader& reader)
+{
+    int32_t ecast2;
+    ReturnStatusVocab cvrt3;
+    if (!reader.readEnum(ecast2, cvrt3)) {
+        reader.fail();
+        return false;
+    } else {
+        status = static_cast<ReturnStatus>(ecast2);
+    }
+    return true;
+}
+
+// write (nested) status field
+bool TickReply::nested_write_status(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(static_cast<int32_t>(status))) {
+        return false;
+    }
+    return true;
+}
+
+// read params_needed field
+bool TickReply::read_params_needed(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(params_needed)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write params_needed field
+bool TickReply::write_params_needed(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(params_needed)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) params_needed field
+bool TickReply::nested_read_params_needed(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(params_needed)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) params_needed field
+bool TickReply::nested_write_params_needed(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(params_needed)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace yarp
+} // namespace BT_wrappers
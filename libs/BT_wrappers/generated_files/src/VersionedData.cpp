@@ -0,0 +1,619 @@
+/*
+ * Copyright (C) 2006-2019 Istituto Italiano di Tecnologia (IIT)
+ * All rights reserved.
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-3-Clause license. See the accompanying LICENSE file for details.
+ */
+
+// Autogenerated by Thrift Compiler (0.12.0-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <yarp/BT_wrappers/VersionedData.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Default constructor
+VersionedData::VersionedData() :
+        WirePortable(),
+        version(0),
+        changed(false),
+        data()
+{
+}
+
+// Constructor with field values
+VersionedData::VersionedData(const std::int64_t version,
+                             const bool changed,
+                             const yarp::os::Property& data) :
+        WirePortable(),
+        version(version),
+        changed(changed),
+        data(data)
+{
+}
+
+// Read structure on a Wire
+bool VersionedData::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_version(reader)) {
+        return false;
+    }
+    if (!read_changed(reader)) {
+        return false;
+    }
+    if (!read_data(reader)) {
+        return false;
+    }
+    return !reader.isError();
+}
+
+// Read structure on a Connection
+bool VersionedData::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(3)) {
+        return false;
+    }
+    return read(reader);
+}
+
+// Write structure on a Wire
+bool VersionedData::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_version(writer)) {
+        return false;
+    }
+    if (!write_changed(writer)) {
+        return false;
+    }
+    if (!write_data(writer)) {
+        return false;
+    }
+    return !writer.isError();
+}
+
+// Write structure on a Connection
+bool VersionedData::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(3)) {
+        return false;
+    }
+    return write(writer);
+}
+
+// Convert to a printable string
+std::string VersionedData::toString() const
+{
+    yarp::os::Bottle b;
+    b.read(*this);
+    return b.toString();
+}
+
+// Editor: default constructor
+VersionedData::Editor::Editor()
+{
+    group = 0;
+    obj_owned = true;
+    obj = new VersionedData;
+    dirty_flags(false);
+    yarp().setOwner(*this);
+}
+
+// Editor: constructor with base class
+VersionedData::Editor::Editor(VersionedData& obj)
+{
+    group = 0;
+    obj_owned = false;
+    edit(obj, false);
+    yarp().setOwner(*this);
+}
+
+// Editor: destructor
+VersionedData::Editor::~Editor()
+{
+    if (obj_owned) {
+        delete obj;
+    }
+}
+
+// Editor: edit
+bool VersionedData::Editor::edit(VersionedData& obj, bool dirty)
+{
+    if (obj_owned) {
+        delete this->obj;
+    }
+    this->obj = &obj;
+    obj_owned = false;
+    dirty_flags(dirty);
+    return true;
+}
+
+// Editor: validity check
+bool VersionedData::Editor::isValid() const
+{
+    return obj != nullptr;
+}
+
+// Editor: state
+VersionedData& VersionedData::Editor::state()
+{
+    return *obj;
+}
+
+// Editor: grouping begin
+void VersionedData::Editor::start_editing()
+{
+    group++;
+}
+
+// Editor: grouping end
+void VersionedData::Editor::stop_editing()
+{
+    group--;
+    if (group == 0 && is_dirty) {
+        communicate();
+    }
+}
+// Editor: version setter
+void VersionedData::Editor::set_version(const std::int64_t version)
+{
+    will_set_version();
+    obj->version = version;
+    mark_dirty_version();
+    communicate();
+    did_set_version();
+}
+
+// Editor: version getter
+std::int64_t VersionedData::Editor::get_version() const
+{
+    return obj->version;
+}
+
+// Editor: version will_set
+bool VersionedData::Editor::will_set_version()
+{
+    return true;
+}
+
+// Editor: version did_set
+bool VersionedData::Editor::did_set_version()
+{
+    return true;
+}
+
+// Editor: changed setter
+void VersionedData::Editor::set_changed(const bool changed)
+{
+    will_set_changed();
+    obj->changed = changed;
+    mark_dirty_changed();
+    communicate();
+    did_set_changed();
+}
+
+// Editor: changed getter
+bool VersionedData::Editor::get_changed() const
+{
+    return obj->changed;
+}
+
+// Editor: changed will_set
+bool VersionedData::Editor::will_set_changed()
+{
+    return true;
+}
+
+// Editor: changed did_set
+bool VersionedData::Editor::did_set_changed()
+{
+    return true;
+}
+
+// Editor: data setter
+void VersionedData::Editor::set_data(const yarp::os::Property& data)
+{
+    will_set_data();
+    obj->data = data;
+    mark_dirty_data();
+    communicate();
+    did_set_data();
+}
+
+// Editor: data getter
+const yarp::os::Property& VersionedData::Editor::get_data() const
+{
+    return obj->data;
+}
+
+// Editor: data will_set
+bool VersionedData::Editor::will_set_data()
+{
+    return true;
+}
+
+// Editor: data did_set
+bool VersionedData::Editor::did_set_data()
+{
+    return true;
+}
+
+// Editor: clean
+void VersionedData::Editor::clean()
+{
+    dirty_flags(false);
+}
+
+// Editor: read
+bool VersionedData::Editor::read(yarp::os::ConnectionReader& connection)
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireReader reader(connection);
+    reader.expectAccept();
+    if (!reader.readListHeader()) {
+        return false;
+    }
+    int len = reader.getLength();
+    if (len == 0) {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(1)) {
+            return false;
+        }
+        writer.writeString("send: 'help' or 'patch (param1 val1) (param2 val2)'");
+        return true;
+    }
+    std::string tag;
+    if (!reader.readString(tag)) {
+        return false;
+    }
+    if (tag == "help") {
+        yarp::os::idl::WireWriter writer(reader);
+        if (writer.isNull()) {
+            return true;
+        }
+        if (!writer.writeListHeader(2)) {
+            return false;
+        }
+        if (!writer.writeTag("many", 1, 0)) {
+            return false;
+        }
+        if (reader.getLength() > 0) {
+            std::string field;
+            if (!reader.readString(field)) {
+                return false;
+            }
+            if (field == "version") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("std::int64_t version")) {
+                    return false;
+                }
+            }
+            if (field == "changed") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("bool changed")) {
+                    return false;
+                }
+            }
+            if (field == "data") {
+                if (!writer.writeListHeader(1)) {
+                    return false;
+                }
+                if (!writer.writeString("yarp::os::Property data")) {
+                    return false;
+                }
+            }
+        }
+        if (!writer.writeListHeader(4)) {
+            return false;
+        }
+        writer.writeString("*** Available fields:");
+        writer.writeString("version");
+        writer.writeString("changed");
+        writer.writeString("data");
+        return true;
+    }
+    bool nested = true;
+    bool have_act = false;
+    if (tag != "patch") {
+        if (((len - 1) % 2) != 0) {
+            return false;
+        }
+        len = 1 + ((len - 1) / 2);
+        nested = false;
+        have_act = true;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (nested && !reader.readListHeader(3)) {
+            return false;
+        }
+        std::string act;
+        std::string key;
+        if (have_act) {
+            act = tag;
+        } else if (!reader.readString(act)) {
+            return false;
+        }
+        if (!reader.readString(key)) {
+            return false;
+        }
+        if (key == "version") {
+            will_set_version();
+            if (!obj->nested_read_version(reader)) {
+                return false;
+            }
+            did_set_version();
+        } else if (key == "changed") {
+            will_set_changed();
+            if (!obj->nested_read_changed(reader)) {
+                return false;
+            }
+            did_set_changed();
+        } else if (key == "data") {
+            will_set_data();
+            if (!obj->nested_read_data(reader)) {
+                return false;
+            }
+            did_set_data();
+        } else {
+            // would be useful to have a fallback here
+        }
+    }
+    reader.accept();
+    yarp::os::idl::WireWriter writer(reader);
+    if (writer.isNull()) {
+        return true;
+    }
+    writer.writeListHeader(1);
+    writer.writeVocab(yarp::os::createVocab('o', 'k'));
+    return true;
+}
+
+// Editor: write
+bool VersionedData::Editor::write(yarp::os::ConnectionWriter& connection) const
+{
+    if (!isValid()) {
+        return false;
+    }
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(dirty_count + 1)) {
+        return false;
+    }
+    if (!writer.writeString("patch")) {
+        return false;
+    }
+    if (is_dirty_version) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("version")) {
+            return false;
+        }
+        if (!obj->nested_write_version(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_changed) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("changed")) {
+            return false;
+        }
+        if (!obj->nested_write_changed(writer)) {
+            return false;
+        }
+    }
+    if (is_dirty_data) {
+        if (!writer.writeListHeader(3)) {
+            return false;
+        }
+        if (!writer.writeString("set")) {
+            return false;
+        }
+        if (!writer.writeString("data")) {
+            return false;
+        }
+        if (!obj->nested_write_data(writer)) {
+            return false;
+        }
+    }
+    return !writer.isError();
+}
+
+// Editor: send if possible
+void VersionedData::Editor::communicate()
+{
+    if (group != 0) {
+        return;
+    }
+    if (yarp().canWrite()) {
+        yarp().write(*this);
+        clean();
+    }
+}
+
+// Editor: mark dirty overall
+void VersionedData::Editor::mark_dirty()
+{
+    is_dirty = true;
+}
+
+// Editor: version mark_dirty
+void VersionedData::Editor::mark_dirty_version()
+{
+    if (is_dirty_version) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_version = true;
+    mark_dirty();
+}
+
+// Editor: changed mark_dirty
+void VersionedData::Editor::mark_dirty_changed()
+{
+    if (is_dirty_changed) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_changed = true;
+    mark_dirty();
+}
+
+// Editor: data mark_dirty
+void VersionedData::Editor::mark_dirty_data()
+{
+    if (is_dirty_data) {
+        return;
+    }
+    dirty_count++;
+    is_dirty_data = true;
+    mark_dirty();
+}
+
+// Editor: dirty_flags
+void VersionedData::Editor::dirty_flags(bool flag)
+{
+    is_dirty = flag;
+    is_dirty_version = flag;
+    is_dirty_changed = flag;
+    is_dirty_data = flag;
+    dirty_count = flag ? 3 : 0;
+}
+
+// read version field
+bool VersionedData::read_version(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI64(version)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write version field
+bool VersionedData::write_version(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(version)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) version field
+bool VersionedData::nested_read_version(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI64(version)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) version field
+bool VersionedData::nested_write_version(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(version)) {
+        return false;
+    }
+    return true;
+}
+
+// read changed field
+bool VersionedData::read_changed(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(changed)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write changed field
+bool VersionedData::write_changed(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(changed)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) changed field
+bool VersionedData::nested_read_changed(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(changed)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) changed field
+bool VersionedData::nested_write_changed(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(changed)) {
+        return false;
+    }
+    return true;
+}
+
+// read data field
+bool VersionedData::read_data(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.read(data)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write data field
+bool VersionedData::write_data(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.write(data)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) data field
+bool VersionedData::nested_read_data(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readNested(data)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) data field
+bool VersionedData::nested_write_data(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeNested(data)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace yarp
+} // namespace BT_wrappers
@@ -0,0 +1,147 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file action_table.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_ACTION_TABLE_H
+#define YARP_BT_MODULES_ACTION_TABLE_H
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <cstdint>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The ActionTable class  Fixed capacity hash table mapping an action_ID to its data.
+ *
+ * All the slots are allocated and default-constructed when the table is created, so no
+ * allocation happens while ticking. Entries are never removed: the set of action_IDs of a
+ * behaviour tree is fixed, therefore once an ID is published its slot stays valid for the
+ * whole life of the table.
+ * - `find` is lock-free and never inserts, it can be called from any thread.
+ * - `findOrInsert` takes a lock only the first time an action_ID is seen.
+ */
+template <typename T>
+class ActionTable
+{
+public:
+    /**
+     * @param capacity  max number of different action_IDs; rounded up to a power of two.
+     */
+    explicit ActionTable(size_t capacity = 256)
+    {
+        _capacity = 1;
+        while(_capacity < capacity)
+            _capacity <<= 1;
+        _mask  = _capacity - 1;
+        _slots = std::unique_ptr<Slot[]>(new Slot[_capacity]);
+    }
+
+    ActionTable(const ActionTable&) = delete;
+    ActionTable& operator=(const ActionTable&) = delete;
+
+    /**
+     * @brief find      Lock-free lookup.
+     * @return          pointer to the data associated to <id>, nullptr if <id> was never inserted.
+     */
+    T* find(std::int32_t id) const
+    {
+        for(size_t i=0, idx=hash(id); i<_capacity; i++, idx=(idx+1) & _mask)
+        {
+            std::int64_t key = _slots[idx].key.load(std::memory_order_acquire);
+            if(key == id)
+                return &_slots[idx].value;
+            if(key == EMPTY)
+                return nullptr;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief findOrInsert  Return the data associated to <id>, reserving a slot if <id> is new.
+     * @return              nullptr if <id> is new and the table is full.
+     */
+    T* findOrInsert(std::int32_t id)
+    {
+        T* data = find(id);
+        if(data)
+            return data;
+
+        std::lock_guard<std::mutex> lock(_insertMutex);
+        for(size_t i=0, idx=hash(id); i<_capacity; i++, idx=(idx+1) & _mask)
+        {
+            std::int64_t key = _slots[idx].key.load(std::memory_order_relaxed);
+            if(key == id)
+                return &_slots[idx].value;
+            if(key == EMPTY)
+            {
+                _slots[idx].key.store(id, std::memory_order_release);
+                _size++;
+                return &_slots[idx].value;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief forEach   Call f(action_ID, data) for each inserted entry.
+     */
+    template <typename F>
+    void forEach(F f) const
+    {
+        for(size_t idx=0; idx<_capacity; idx++)
+        {
+            std::int64_t key = _slots[idx].key.load(std::memory_order_acquire);
+            if(key != EMPTY)
+                f(static_cast<std::int32_t>(key), _slots[idx].value);
+        }
+    }
+
+    size_t capacity() const { return _capacity; }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(_insertMutex);
+        return _size;
+    }
+
+private:
+    // action_ID is 32 bit, so a 64 bit key leaves room for a marker of unused slots
+    static constexpr std::int64_t EMPTY = std::numeric_limits<std::int64_t>::min();
+
+    struct Slot
+    {
+        std::atomic<std::int64_t> key {EMPTY};
+        T value;
+    };
+
+    size_t hash(std::int32_t id) const
+    {
+        // Fibonacci hashing, consecutive IDs end up far apart
+        return (static_cast<std::uint32_t>(id) * 2654435769u) & _mask;
+    }
+
+    size_t                      _capacity;
+    size_t                      _mask;
+    size_t                      _size {0};
+    std::unique_ptr<Slot[]>     _slots;
+    mutable std::mutex          _insertMutex;
+};
+
+template <typename T>
+constexpr std::int64_t ActionTable<T>::EMPTY;
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_ACTION_TABLE_H
@@ -12,10 +12,13 @@
  */
 
 #include "blackboard_client.h"
+#include "property_merge.h"
 
 #include <memory>
 #include <iostream>
+#include <iterator>
 #include <algorithm>
+#include <yarp/os/Time.h>
 #include <yarp/os/LogStream.h>
 
 using namespace std;
@@ -26,7 +29,24 @@ BlackBoardClient::BlackBoardClient() : BlackBoardWrapper()
 { }
 
 BlackBoardClient::~BlackBoardClient()
-{ }
+{
+    // the patterns watched by no other client of the process are unwatched. The RPC is not tried if the
+    // blackboard is not reachable: it drops the watches of the subscribers gone anyway
+    if(m_subscription)
+    {
+        for(const auto &pattern : m_watched)
+        {
+            if(m_subscription->remove(pattern) && m_clientPort.getOutputCount() > 0 && m_deadline.begin())
+            {
+                double start = Time::now();
+                BlackBoardWrapper::unwatch(pattern, m_subscription->name());
+                m_deadline.end(true, start);
+            }
+        }
+        m_subscription.reset();
+    }
+    m_clientPort.close();
+}
 
 bool BlackBoardClient::configureBlackBoardClient(std::string portPrefix, std::string clientName)
 {
@@ -51,9 +71,309 @@ bool BlackBoardClient::configureBlackBoardClient(std::string portPrefix, std::st
 
 bool BlackBoardClient::connectToBlackBoard(std::string serverName)
 {
+    m_serverName = serverName;
     std::string server{serverName + "/rpc:s"};
     yDebug() << "Connecting to " << server;
-    return m_clientPort.addOutput(server);
+    // from now on, lost connections are restored when the blackboard is contacted again
+    m_deadline.attach(m_clientPort, server);
+    return m_deadline.connect();
+}
+
+bool BlackBoardClient::setTimeout(double seconds)
+{
+    return m_deadline.setTimeout(seconds);
+}
+
+Property BlackBoardClient::getStats() const
+{
+    Property stats;
+    m_deadline.toProperty(stats);
+    return stats;
+}
+
+Value BlackBoardClient::getField(const std::string& target, const std::string& key)
+{
+    // watched targets are available locally
+    Value value;
+    if(m_subscription && m_subscription->findField(target, key, value))
+        return value;
+
+    if(!m_deadline.begin())
+        return Value();
+
+    double start = Time::now();
+    value = BlackBoardWrapper::getField(target, key);
+    if(!m_deadline.end(true, start))
+        return Value();
+    return value;
+}
+
+bool BlackBoardClient::setField(const std::string& target, const std::string& key, const Value& value)
+{
+    if(!m_deadline.begin())
+        return false;
+
+    double start = Time::now();
+    bool ret = BlackBoardWrapper::setField(target, key, value);
+    if(!m_deadline.end(true, start) || !ret)
+        return false;
+
+    if(m_subscription)
+        m_subscription->put(target, key, value);
+
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto cached = m_cache.find(target);
+    if(cached != m_cache.end())
+    {
+        cached->second.data.put(key, value);
+        cached->second.stamp = BlackBoardSubscription::nextStamp();
+    }
+    return true;
+}
+
+std::vector<Property> BlackBoardClient::getMany(const std::vector<std::string>& targets)
+{
+    if(!m_deadline.begin())
+        return std::vector<Property>(targets.size());
+
+    double start = Time::now();
+    std::vector<Property> data = BlackBoardWrapper::getMany(targets);
+    if(!m_deadline.end(true, start))
+        return std::vector<Property>(targets.size());
+
+    // blackboards not supporting getMany reply with an empty list
+    if(data.size() != targets.size())
+    {
+        data.clear();
+        for(const auto &target : targets)
+            data.push_back(getData(target));
+    }
+    return data;
+}
+
+bool BlackBoardClient::setMany(const std::vector<std::string>& targets, const std::vector<Property>& data)
+{
+    if(!m_deadline.begin())
+        return false;
+
+    double start = Time::now();
+    bool ret = BlackBoardWrapper::setMany(targets, data);
+    if(!m_deadline.end(true, start) || !ret)
+        return false;
+
+    for(size_t i=0; i<targets.size(); i++)
+        mergeLocally(targets[i], data[i]);
+    return true;
+}
+
+bool BlackBoardClient::watch(const std::string& pattern)
+{
+    if(!m_subscription)
+    {
+        m_subscription = BlackBoardSubscription::of(m_portPrefix, m_clientName, m_serverName);
+        if(!m_subscription)
+            return false;
+    }
+
+    bool first = m_subscription->add(pattern);
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_watched.push_back(pattern);
+    }
+
+    // already subscribed, only a pattern new for the process has to be sent
+    if(m_subscription->connected())
+    {
+        if(!first)
+            return true;
+        if(!m_deadline.begin())
+            return false;
+        double start = Time::now();
+        bool ret = BlackBoardWrapper::watch(pattern, m_subscription->name());
+        return m_deadline.end(true, start) && ret;
+    }
+
+    if(!subscribe())
+    {
+        yDebug() << m_clientName << ": blackboard " << m_serverName << " does not publish its changes, getData will poll it";
+        return false;
+    }
+    return true;
+}
+
+bool BlackBoardClient::unwatch(const std::string& pattern)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        auto it = std::find(m_watched.begin(), m_watched.end(), pattern);
+        if(it == m_watched.end())
+            return false;
+        m_watched.erase(it);
+    }
+
+    // still watched by other clients of the process
+    if(!m_subscription->remove(pattern))
+        return true;
+
+    if(!m_deadline.begin())
+        return false;
+    double start = Time::now();
+    bool ret = BlackBoardWrapper::unwatch(pattern, m_subscription->name());
+    return m_deadline.end(true, start) && ret;
+}
+
+bool BlackBoardClient::subscribe()
+{
+    m_watchEpoch = m_deadline.reconnections();
+
+    // another client of the process subscribed again already
+    if(m_subscription->connected())
+        return true;
+
+    // the copy of the watched targets is dropped, the updates received so far may have gaps
+    if(!m_subscription->connect())
+        return false;
+
+    // each watch makes the blackboard send the current content of the matching targets
+    bool ret = true;
+    for(const auto &pattern : m_subscription->patterns())
+    {
+        if(!m_deadline.begin())
+            return false;
+        double start = Time::now();
+        ret &= BlackBoardWrapper::watch(pattern, m_subscription->name());
+        ret &= m_deadline.end(true, start);
+    }
+    return ret;
+}
+
+void BlackBoardClient::mergeLocally(const std::string& target, const Property& datum)
+{
+    if(m_subscription)
+        m_subscription->merge(target, datum);
+
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto cached = m_cache.find(target);
+    if(cached != m_cache.end())
+    {
+        mergeProperty(cached->second.data, datum);
+        cached->second.stamp = BlackBoardSubscription::nextStamp();
+    }
+}
+
+Property BlackBoardClient::getData(const std::string& target)
+{
+    std::int64_t version;
+    return getData(target, version);
+}
+
+Property BlackBoardClient::getData(const std::string& target, std::int64_t &version)
+{
+    version = 0;
+
+    if(m_subscription)
+    {
+        // the blackboard came back after being lost, subscribe again
+        if(!m_subscription->connected() && m_watchEpoch != m_deadline.reconnections())
+            subscribe();
+
+        Property data;
+        if(m_subscription->find(target, data, version))
+            return data;
+    }
+
+    if(!m_deadline.begin())
+        return Property();
+
+    // ask for the data only if it changed since the last read
+    std::int64_t knownVersion = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        // versions start again from scratch when the blackboard is restarted, and a restarted blackboard
+        // is always reconnected: the targets read before are no more valid. Watched ones are cleared by subscribe
+        if(m_cacheEpoch != m_deadline.reconnections())
+        {
+            m_cacheEpoch = m_deadline.reconnections();
+            m_cache.clear();
+        }
+
+        auto cached = m_cache.find(target);
+        if(cached != m_cache.end())
+            knownVersion = cached->second.version;
+    }
+
+    double start = Time::now();
+    VersionedData reply = BlackBoardWrapper::getDataIfChanged(target, knownVersion);
+    if(!m_deadline.end(true, start))
+        return Property();
+
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        auto cached = m_cache.find(target);
+        if(reply.changed)
+        {
+            // targets not existing have no version, they are not cached
+            if(reply.version > 0 && (cached != m_cache.end() || m_cache.size() < MAX_CACHED))
+            {
+                CachedData &entry = m_cache[target];
+                if(reply.version >= entry.version)
+                {
+                    entry.data    = reply.data;
+                    entry.version = reply.version;
+                    entry.stamp   = BlackBoardSubscription::nextStamp();
+                }
+                // a newer reply was stored meanwhile: the reply is what is returned
+                if(entry.version == reply.version)
+                    version = entry.stamp;
+            }
+            else if(reply.version == 0 && cached != m_cache.end())
+                m_cache.erase(cached);
+            return reply.data;
+        }
+
+        // blackboards not supporting versions reply with the default value, i.e. unchanged with version 0
+        if(reply.version != 0 && cached != m_cache.end())
+        {
+            version = cached->second.stamp;
+            return cached->second.data;
+        }
+    }
+
+    if(!m_deadline.begin())
+        return Property();
+
+    start = Time::now();
+    Property data = BlackBoardWrapper::getData(target);
+    if(!m_deadline.end(true, start))
+        return Property();
+    return data;
+}
+
+bool BlackBoardClient::setData(const std::string& target, const Property& datum)
+{
+    if(!m_deadline.begin())
+        return false;
+
+    double start = Time::now();
+    bool ret = BlackBoardWrapper::setData(target, datum);
+    // a false reply is not a communication failure, no backoff for it
+    if(!m_deadline.end(true, start) || !ret)
+        return false;
+
+    mergeLocally(target, datum);
+    return true;
 }
 
+bool BlackBoardClient::setDataWithTTL(const std::string& target, const Property& datum, const double ttl)
+{
+    if(!m_deadline.begin())
+        return false;
 
+    double start = Time::now();
+    bool ret = BlackBoardWrapper::setDataWithTTL(target, datum, ttl);
+    if(!m_deadline.end(true, start) || !ret)
+        return false;
+
+    mergeLocally(target, datum);
+    return true;
+}
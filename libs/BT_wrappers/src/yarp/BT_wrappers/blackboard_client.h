@@ -13,13 +13,18 @@
 #ifndef YARP_BT_MODULES_BLACKBOARD_CLIENT_H
 #define YARP_BT_MODULES_BLACKBOARD_CLIENT_H
 
+#include <map>
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <memory>
+#include <vector>
 
 #include <yarp/os/Port.h>
 #include <yarp/BT_wrappers/BT_request.h>
 #include <yarp/BT_wrappers/BlackBoardWrapper.h>
+#include <yarp/BT_wrappers/rpc_deadline.h>
+#include <yarp/BT_wrappers/blackboard_subscription.h>
 
 // #include <BTMonitorMsg.h>   // TBD
 
@@ -50,27 +55,105 @@ public:
      */
     bool connectToBlackBoard(const std::string serverPort="/blackboard");
 
+    /**
+     * @brief setTimeout    Max time to wait for the reply of the blackboard, in seconds.
+     *                      After a failure, getData and setData fail immediately until the blackboard is
+     *                      tried again with an exponential backoff (see RpcDeadline).
+     *                      Zero or negative waits forever (default).
+     */
+    bool setTimeout(double seconds);
+
+    /**
+     * @brief getStats      Timeout and counters of expired deadlines, fast failures and reconnections.
+     */
+    yarp::os::Property getStats() const;
+
+    /**
+     * @brief watch         Subscribe to the changes of the targets matching <pattern>, i.e. a target name
+     *                      or a prefix followed by '*'.
+     *                      The blackboard pushes the changes on its updates:o port and a local copy of the
+     *                      watched targets is kept: from now on getData for them is answered locally, without
+     *                      contacting the blackboard. The local copy may lag the blackboard by the time needed
+     *                      to deliver an update. If the subscription is lost, getData goes back to RPCs.
+     *                      The clients of a process with the same port prefix share the subscription (see
+     *                      BlackBoardSubscription), so the updates are received once per process.
+     * @return              false if the blackboard does not support subscriptions
+     */
+    bool watch(const std::string& pattern);
+
+    /**
+     * @brief unwatch       Stop watching <pattern>, as given to watch. The other clients of the process
+     *                      watching it keep receiving its changes.
+     */
+    bool unwatch(const std::string& pattern);
+
     //Thrift services inherited from BTCmd
     /**
      * @brief Retrieve the Property associated to a key target
      * @param target name of the target to be retrieved
-     * @return set of parameters associated
+     * @return set of parameters associated, empty in case of failure
      *
-     * yarp::os::Property getData(const std::string& target);
+     * NOTE: the last targets read are kept locally with their version, and
+     * transferred again only if they changed in the meantime.
+     */
+    yarp::os::Property getData(const std::string& target) override;
+
+    /**
+     * @brief As above, also providing the version of the returned content
+     * @param version set to a number that changes whenever the content of <target> read by this client
+     *        may have changed, e.g. to be given to TickClient::request_tick along with the params read.
+     *        Only targets kept locally (watched or among the last ones read) have one, 0 otherwise.
      */
-    using BlackBoardWrapper::getData;
+    yarp::os::Property getData(const std::string& target, std::int64_t &version);
 
     /**
      * @brief Set addictional parameters to a key target
      * @param target name of the target to add parameters
      * @param datum set of parameters to be set.
+     * @return true if the data has been set, false otherwise
      *
      * NOTE: the parameters will be merged on server side with the ones
      * already existings.
+     */
+    bool setData(const std::string& target, const yarp::os::Property& datum);
+
+    /**
+     * @brief Set addictional parameters to a key target, as setData, and make the whole
+     *        target expire after some time
+     * @param ttl time to live of the target, in seconds. Zero or less to never expire.
+     * @return true if the data has been set, false otherwise
+     */
+    bool setDataWithTTL(const std::string& target, const yarp::os::Property& datum, const double ttl);
+
+    /**
+     * @brief Retrieve a single field of a target, without transferring the whole Property
+     * @param target name of the target
+     * @param key name of the field
+     * @return value of the field, a null Value if missing or in case of failure
+     */
+    yarp::os::Value getField(const std::string& target, const std::string& key) override;
+
+    /**
+     * @brief Set a single field of a target, leaving the others as they are
+     * @return true if the field has been set, false otherwise
+     */
+    bool setField(const std::string& target, const std::string& key, const yarp::os::Value& value) override;
+
+    /**
+     * @brief Retrieve the Property associated to several targets with a single message
+     * @param targets names of the targets to be retrieved
+     * @return set of parameters associated to each target, in the same order as <targets>.
+     *         The contents are read together on server side, so they are consistent with each other.
+     */
+    std::vector<yarp::os::Property> getMany(const std::vector<std::string>& targets) override;
+
+    /**
+     * @brief Merge data[i] into targets[i] for all i with a single message
+     * @return true if the data has been set, false otherwise
      *
-     * bool setData(const std::string& target, const yarp::os::Property& datum);
+     * NOTE: the writes are applied together on server side, readers see either none or all of them.
      */
-    using BlackBoardWrapper::setData;
+    bool setMany(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data) override;
 
     /**
      * @brief Clear all the content of the remote blackboard
@@ -96,6 +179,23 @@ public:
      */
     using BlackBoardWrapper::listTarget;
 
+    /**
+     * @brief Provide the targets starting with <prefix>, in alphabetical order, a page at a time
+     * @param limit max number of targets of the page, all if zero or less
+     * @param cursor empty for the first page, then the cursor of the previous page
+     * @return the targets and the cursor of the next page, empty if this is the last one
+     *
+     * TargetPage listTargets(const std::string& prefix, const std::int32_t limit, const std::string& cursor);
+     */
+    using BlackBoardWrapper::listTargets;
+
+    /**
+     * @brief As listTargets, also providing the content of each target
+     *
+     * TargetPage scan(const std::string& prefix, const std::int32_t limit, const std::string& cursor);
+     */
+    using BlackBoardWrapper::scan;
+
     /**
      * @brief Reset all blackboard memory to its initialization values from
      *        config file
@@ -104,12 +204,63 @@ public:
      */
     using BlackBoardWrapper::resetData;
 
+    /**
+     * @brief Memory used by the remote blackboard: entries, bytes, max_bytes, evictions
+     *        and expirations
+     *
+     * yarp::os::Property getMemoryStats();
+     */
+    using BlackBoardWrapper::getMemoryStats;
+
+    /**
+     * @brief Targets with a position on map <mapId> within <radius> of (x, y, z), the nearest first,
+     *        along with their distance and content. The position of a target is either its
+     *        (pose (x y z)) or its (location (map_id name) (x x) (y y)).
+     *
+     * std::vector<SpatialMatch> findInRadius(const std::string& mapId, const double x, const double y, const double z, const double radius);
+     */
+    using BlackBoardWrapper::findInRadius;
+
+    /**
+     * @brief The <count> targets with a position on map <mapId> nearest to (x, y, z), the nearest first
+     *
+     * std::vector<SpatialMatch> findNearest(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count);
+     */
+    using BlackBoardWrapper::findNearest;
+
     using BlackBoardWrapper::help;
 
 private:
     std::string     m_portPrefix;
     std::string     m_clientName;
+    std::string     m_serverName;
     yarp::os::Port  m_clientPort;
+    RpcDeadline     m_deadline;
+
+    // Local copy of the last targets read, validated by their version at each read.
+    // The watched ones are kept by m_subscription instead
+    static constexpr size_t MAX_CACHED = 256;
+
+    struct CachedData
+    {
+        yarp::os::Property  data;
+        std::int64_t        version {0};    // version of the last reply stored
+        std::int64_t        stamp {0};      // BlackBoardSubscription::nextStamp() when data last changed
+    };
+
+    std::mutex                                              m_cacheMutex;
+    std::map<std::string, CachedData>                       m_cache;
+    // blackboard versions start again from scratch if it is restarted and do not see local changes,
+    // the versions given by getData are stamps of this process instead
+    std::uint64_t                                           m_cacheEpoch {0};   // m_deadline.reconnections() when the last targets read were cached
+
+    std::shared_ptr<BlackBoardSubscription>                 m_subscription;     // set by the first watch
+    std::vector<std::string>                                m_watched;          // patterns watched by this client
+    std::uint64_t                                           m_watchEpoch {0};   // m_deadline.reconnections() at subscription
+
+    bool subscribe();
+    // local copies have to see the changes written before the updates come back from the blackboard
+    void mergeLocally(const std::string& target, const yarp::os::Property& datum);
 };
 
 }}
@@ -0,0 +1,420 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file blackboard_journal.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "blackboard_journal.h"
+#include "property_merge.h"
+
+#include <yarp/os/Time.h>
+#include <yarp/os/LogStream.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+
+static const char *OP_SET       = "set";        // (set <target> <entries> [<expiry>]), merged as setData
+static const char *OP_REPLACE   = "replace";    // (replace <target> <entries> [<expiry>])
+static const char *OP_CLEAR     = "clear";      // (clear <target>)
+static const char *OP_CLEAR_ALL = "clear_all";  // (clear_all)
+static const char *OP_RESET     = "reset";      // (reset), back to the initial values
+
+static void syncFile(std::FILE *file)
+{
+    std::fflush(file);
+#ifdef _WIN32
+    _commit(_fileno(file));
+#else
+    fsync(fileno(file));
+#endif
+}
+
+// Make the renames done in <dir> durable
+static void syncDir(const std::string &dir)
+{
+#ifndef _WIN32
+    int fd = ::open(dir.c_str(), O_RDONLY);
+    if(fd >= 0)
+    {
+        fsync(fd);
+        ::close(fd);
+    }
+#endif
+}
+
+// Append the content of <from> to <to>, synced
+static bool appendFile(const std::string &from, const std::string &to)
+{
+    std::FILE *src = std::fopen(from.c_str(), "rb");
+    if(!src)
+        return false;
+    std::FILE *dst = std::fopen(to.c_str(), "ab");
+    if(!dst)
+    {
+        std::fclose(src);
+        return false;
+    }
+
+    bool ok = true;
+    char buffer[65536];
+    size_t size;
+    while(ok && (size = std::fread(buffer, 1, sizeof(buffer), src)) > 0)
+        ok = (std::fwrite(buffer, 1, size, dst) == size);
+    ok &= !std::ferror(src);
+    syncFile(dst);
+    std::fclose(dst);
+    std::fclose(src);
+    return ok;
+}
+
+static void addOp(Bottle &record, const char *op, const std::string &target)
+{
+    Bottle &entry = record.addList();
+    entry.addString(op);
+    entry.addString(target);
+}
+
+static Bottle& addOp(Bottle &record, const char *op, const std::string &target, const Property &data)
+{
+    Bottle &entry = record.addList();
+    entry.addString(op);
+    entry.addString(target);
+    entry.addList() = propertyEntries(data);
+    return entry;
+}
+
+BlackBoardJournal::~BlackBoardJournal()
+{
+    close();
+}
+
+bool BlackBoardJournal::fromString(const std::string &name, Durability &durability)
+{
+    if(name == "always")
+        durability = DURABILITY_ALWAYS;
+    else if(name == "batched")
+        durability = DURABILITY_BATCHED;
+    else if(name == "off")
+        durability = DURABILITY_OFF;
+    else
+        return false;
+    return true;
+}
+
+std::string BlackBoardJournal::logPath() const      { return _dir + "/blackboard.log"; }
+std::string BlackBoardJournal::oldLogPath() const   { return _dir + "/blackboard.log.old"; }
+std::string BlackBoardJournal::snapshotPath() const { return _dir + "/blackboard.snapshot"; }
+
+bool BlackBoardJournal::open(const std::string &dir, Durability durability, double syncPeriod)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _dir        = dir;
+    _durability = durability;
+    _syncPeriod = syncPeriod;
+    _log        = std::fopen(logPath().c_str(), "ab");
+    if(!_log)
+    {
+        yError() << "BlackBoardJournal: cannot open " << logPath();
+        return false;
+    }
+    _lastSync = Time::now();
+    return true;
+}
+
+void BlackBoardJournal::close()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!_log)
+        return;
+    syncFile(_log);
+    std::fclose(_log);
+    _log = nullptr;
+}
+
+void BlackBoardJournal::append(Bottle &record)
+{
+    size_t size = 0;
+    const char *data = record.toBinary(&size);
+    std::uint32_t length = static_cast<std::uint32_t>(size);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!_log)
+        return;
+
+    if(std::fwrite(&length, sizeof(length), 1, _log) != 1 ||
+       std::fwrite(data, 1, size, _log) != size)
+    {
+        yError() << "BlackBoardJournal: cannot write " << logPath();
+        return;
+    }
+    _records++;
+    _dirty = true;
+
+    if(_durability == DURABILITY_OFF)
+        std::fflush(_log);
+    else
+        syncLocked(_durability == DURABILITY_ALWAYS);
+}
+
+void BlackBoardJournal::syncLocked(bool force)
+{
+    if(!_log || !_dirty)
+        return;
+
+    double now = Time::now();
+    if(!force && now - _lastSync < _syncPeriod)
+        return;
+
+    syncFile(_log);
+    _lastSync = now;
+    _dirty    = false;
+}
+
+void BlackBoardJournal::sync()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_durability == DURABILITY_BATCHED)
+        syncLocked(false);
+}
+
+void BlackBoardJournal::logSet(const std::string &target, const Property &datum)
+{
+    Bottle record;
+    addOp(record, OP_SET, target, datum);
+    append(record);
+}
+
+void BlackBoardJournal::logSet(const std::string &target, const Property &datum, double expiry)
+{
+    Bottle record;
+    addOp(record, OP_SET, target, datum).addFloat64(expiry);
+    append(record);
+}
+
+void BlackBoardJournal::logSetMany(const std::vector<std::string> &targets, const std::vector<Property> &data)
+{
+    Bottle record;
+    for(size_t i=0; i<targets.size() && i<data.size(); i++)
+        addOp(record, OP_SET, targets[i], data[i]);
+    append(record);
+}
+
+void BlackBoardJournal::logClear(const std::string &target)
+{
+    Bottle record;
+    addOp(record, OP_CLEAR, target);
+    append(record);
+}
+
+void BlackBoardJournal::logClearAll()
+{
+    Bottle record;
+    record.addList().addString(OP_CLEAR_ALL);
+    append(record);
+}
+
+void BlackBoardJournal::logReset()
+{
+    Bottle record;
+    record.addList().addString(OP_RESET);
+    append(record);
+}
+
+bool BlackBoardJournal::rotate()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!_log)
+        return false;
+
+    // The records of the log move to the old log, kept until a snapshot following them is safely written.
+    // If the last snapshot failed, the old log still holds records of no snapshot: these are appended to it
+    syncFile(_log);
+    std::fclose(_log);
+    std::FILE *old = std::fopen(oldLogPath().c_str(), "rb");
+    bool moved;
+    if(old)
+    {
+        std::fclose(old);
+        moved = appendFile(logPath(), oldLogPath()) && std::remove(logPath().c_str()) == 0;
+    }
+    else
+        moved = (std::rename(logPath().c_str(), oldLogPath().c_str()) == 0);
+    syncDir(_dir);
+
+    // if the records could not be moved, the log goes on and no snapshot follows
+    _log = std::fopen(logPath().c_str(), "ab");
+    if(!_log)
+    {
+        yError() << "BlackBoardJournal: cannot open " << logPath();
+        return false;
+    }
+    if(!moved)
+    {
+        yError() << "BlackBoardJournal: cannot move " << logPath() << " to " << oldLogPath() << ", snapshot skipped";
+        return false;
+    }
+    _records = 0;
+    _dirty   = false;
+    return true;
+}
+
+bool BlackBoardJournal::writeSnapshot(const Storage &storage, const Expiries &expiries)
+{
+    std::string tmpPath = snapshotPath() + ".tmp";
+    std::FILE *file = std::fopen(tmpPath.c_str(), "wb");
+    if(!file)
+    {
+        yError() << "BlackBoardJournal: cannot open " << tmpPath;
+        return false;
+    }
+
+    bool ok = true;
+    for(const auto &entry : storage)
+    {
+        Bottle record;
+        Bottle &op = addOp(record, OP_REPLACE, entry.first, entry.second);
+        auto expiry = expiries.find(entry.first);
+        if(expiry != expiries.end())
+            op.addFloat64(expiry->second);
+
+        size_t size = 0;
+        const char *data = record.toBinary(&size);
+        std::uint32_t length = static_cast<std::uint32_t>(size);
+        ok &= (std::fwrite(&length, sizeof(length), 1, file) == 1);
+        ok &= (std::fwrite(data, 1, size, file) == size);
+    }
+    ok &= (std::fflush(file) == 0);
+    syncFile(file);
+    ok &= (std::fclose(file) == 0);
+
+    // replace the snapshot atomically: a crash leaves either the old one, with the old log, or the new one
+    if(ok)
+    {
+#ifdef _WIN32
+        std::remove(snapshotPath().c_str());
+#endif
+        ok = (std::rename(tmpPath.c_str(), snapshotPath().c_str()) == 0);
+    }
+    if(!ok)
+    {
+        // the old log is kept: recovery replays it over the previous snapshot, next rotate appends to it
+        yError() << "BlackBoardJournal: cannot write " << snapshotPath();
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    syncDir(_dir);
+
+    // only now the snapshot holds all the records of the old log
+    std::remove(oldLogPath().c_str());
+    syncDir(_dir);
+    return true;
+}
+
+bool BlackBoardJournal::recover(Storage &storage, Expiries &expiries, const Storage &initial)
+{
+    Storage  recovered;
+    Expiries recoveredExpiries;
+    bool found = false;
+    // the old log is there only if the snapshot following it was not completed. Replaying it over
+    // a newer snapshot is harmless, since each record sets the final value of what it touches
+    found |= readRecords(snapshotPath(), recovered, recoveredExpiries, initial);
+    found |= readRecords(oldLogPath(), recovered, recoveredExpiries, initial);
+    found |= readRecords(logPath(), recovered, recoveredExpiries, initial);
+
+    if(found)
+    {
+        storage  = std::move(recovered);
+        expiries = std::move(recoveredExpiries);
+    }
+    return found;
+}
+
+bool BlackBoardJournal::readRecords(const std::string &path, Storage &storage, Expiries &expiries, const Storage &initial)
+{
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if(!file)
+        return false;
+
+    std::vector<char> buffer;
+    std::uint32_t length = 0;
+    size_t count = 0;
+    while(std::fread(&length, sizeof(length), 1, file) == 1)
+    {
+        buffer.resize(length);
+        if(std::fread(buffer.data(), 1, length, file) != length)
+        {
+            yWarning() << "BlackBoardJournal: " << path << " ends with a truncated record, ignored";
+            break;
+        }
+
+        Bottle record;
+        record.fromBinary(buffer.data(), length);
+        apply(record, storage, expiries, initial);
+        count++;
+    }
+    std::fclose(file);
+
+    yInfo() << "BlackBoardJournal: recovered " << count << " records from " << path;
+    return true;
+}
+
+void BlackBoardJournal::apply(const Bottle &record, Storage &storage, Expiries &expiries, const Storage &initial)
+{
+    for(size_t i=0; i<record.size(); i++)
+    {
+        Bottle *op = record.get(i).asList();
+        if(!op || op->size() == 0)
+            continue;
+
+        std::string name   = op->get(0).asString();
+        std::string target = op->size() > 1 ? op->get(1).asString() : std::string();
+        Property data;
+        if(op->size() > 2 && op->get(2).isList())
+            data.fromString(op->get(2).asList()->toString());
+
+        // a set without expiry leaves it as it is, a replace without expiry never expires
+        bool   hasExpiry = op->size() > 3;
+        double expiry    = hasExpiry ? op->get(3).asFloat64() : 0.0;
+
+        if(name == OP_SET)
+        {
+            mergeProperty(storage[target], data);
+            if(hasExpiry && expiry > 0.0)
+                expiries[target] = expiry;
+            else if(hasExpiry)
+                expiries.erase(target);
+        }
+        else if(name == OP_REPLACE)
+        {
+            storage[target] = data;
+            if(expiry > 0.0)
+                expiries[target] = expiry;
+            else
+                expiries.erase(target);
+        }
+        else if(name == OP_CLEAR)
+        {
+            storage.erase(target);
+            expiries.erase(target);
+        }
+        else if(name == OP_CLEAR_ALL || name == OP_RESET)
+        {
+            // the initial values never expire
+            storage = (name == OP_RESET) ? initial : Storage();
+            expiries.clear();
+        }
+    }
+}
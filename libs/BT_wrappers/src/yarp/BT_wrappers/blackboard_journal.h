@@ -0,0 +1,137 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file blackboard_journal.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_BLACKBOARD_JOURNAL_H
+#define YARP_BT_MODULES_BLACKBOARD_JOURNAL_H
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The BlackBoardJournal class   Durable storage for the content of the blackboard.
+ *
+ * Each modification is appended to a write-ahead log as a single binary record, so that a modification
+ * involving several targets is either recovered entirely or not at all. From time to time the whole content
+ * is written to a compact binary snapshot and the log restarts, so that recovery reads the last snapshot and
+ * replays only the log written after it.
+ *
+ * The durability mode trades the latency of the writes for the modifications lost in case of a crash:
+ * - always:  the log is synced to disk at each modification, nothing is lost;
+ * - batched: the log is synced at most every <syncPeriod> seconds, the last ones may be lost;
+ * - off:     the log is handed to the operating system and never synced, a power loss may lose more.
+ *
+ * Modifications have to be logged in the same order they are applied to the storage.
+ * Expiries are stored as absolute times, i.e. yarp::os::Time::now() at which the target is dropped, so that
+ * the time spent down counts as well.
+ */
+class BlackBoardJournal
+{
+public:
+    enum Durability { DURABILITY_OFF, DURABILITY_BATCHED, DURABILITY_ALWAYS };
+
+    using Storage  = std::map<std::string, yarp::os::Property>;
+    using Expiries = std::map<std::string, double>;      // target -> expiry, only the targets that expire
+
+    ~BlackBoardJournal();
+
+    /**
+     * @brief fromString    Durability mode from its name, i.e. "always", "batched" or "off"
+     * @return              false if <name> is not valid
+     */
+    static bool fromString(const std::string &name, Durability &durability);
+
+    /**
+     * @brief open          Open the journal in <dir>, which must exist.
+     * @param syncPeriod    max time between two syncs in batched mode, in seconds
+     */
+    bool open(const std::string &dir, Durability durability, double syncPeriod = 0.1);
+    void close();
+    bool isOpen() const { return _log != nullptr; }
+
+    /**
+     * @brief recover       Rebuild the content of the blackboard from the last snapshot and the log.
+     *                      A record truncated by a crash ends the log.
+     * @param storage       filled with the recovered content, untouched if there is nothing to recover
+     * @param expiries      filled with the expiries of the recovered content, as storage. Expired targets are
+     *                      recovered as well, it is up to the caller to drop them
+     * @param initial       initial values of the blackboard, restored by the resets found in the log
+     * @return              true if something was recovered
+     */
+    bool recover(Storage &storage, Expiries &expiries, const Storage &initial);
+
+    // Modifications. Each call is a single record.
+    void logSet(const std::string &target, const yarp::os::Property &datum);                   // expiry unchanged
+    void logSet(const std::string &target, const yarp::os::Property &datum, double expiry);    // 0 never expires
+    void logSetMany(const std::vector<std::string> &targets, const std::vector<yarp::os::Property> &data);
+    void logClear(const std::string &target);
+    void logClearAll();
+    void logReset();        // back to the initial values
+
+    /**
+     * @brief sync          In batched mode, sync the log if the sync period elapsed. To be called periodically,
+     *                      so that the last modifications are synced even if no more modifications arrive.
+     */
+    void sync();
+
+    /**
+     * @brief rotate        Move the records logged so far to the old log and start a new log, to be followed by
+     *                      writeSnapshot of the content at this time.
+     *                      No modification may be logged between getting the content and calling rotate.
+     * @return              false if the records could not be moved: the log goes on, no snapshot may be written
+     */
+    bool rotate();
+
+    /**
+     * @brief writeSnapshot Replace the snapshot with <storage> and its <expiries>, then drop the old log. The old log is removed only
+     *                      once the new snapshot is synced and renamed into place: if writing fails, it is kept
+     *                      and the next rotate appends to it.
+     */
+    bool writeSnapshot(const Storage &storage, const Expiries &expiries);
+
+    std::uint64_t records() const { return _records; }    // records in the current log, read without the lock
+
+private:
+    std::string     _dir;
+    Durability      _durability {DURABILITY_BATCHED};
+    double          _syncPeriod {0.1};
+
+    std::mutex      _mutex;
+    std::FILE      *_log {nullptr};
+    double          _lastSync {0.0};
+    bool            _dirty {false};         // something written after the last sync
+    std::atomic<std::uint64_t>  _records {0};
+
+    std::string logPath() const;
+    std::string oldLogPath() const;
+    std::string snapshotPath() const;
+
+    void append(yarp::os::Bottle &record);
+    void syncLocked(bool force);
+
+    static bool readRecords(const std::string &path, Storage &storage, Expiries &expiries, const Storage &initial);
+    static void apply(const yarp::os::Bottle &record, Storage &storage, Expiries &expiries, const Storage &initial);
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_BLACKBOARD_JOURNAL_H
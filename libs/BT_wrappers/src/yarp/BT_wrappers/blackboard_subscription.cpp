@@ -0,0 +1,195 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file blackboard_subscription.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "blackboard_subscription.h"
+#include "property_merge.h"
+
+#include <algorithm>
+#include <yarp/os/Network.h>
+#include <yarp/os/LogStream.h>
+
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+
+std::shared_ptr<BlackBoardSubscription> BlackBoardSubscription::of(const std::string &portPrefix, const std::string &clientName,
+                                                                   const std::string &serverName)
+{
+    static std::mutex registryMutex;
+    static std::map<std::string, std::weak_ptr<BlackBoardSubscription>> registry;
+
+    const std::string key = portPrefix + " " + serverName;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::shared_ptr<BlackBoardSubscription> subscription = registry[key].lock();
+    if(subscription)
+        return subscription;
+
+    std::string name = portPrefix + "/" + clientName + "/blackboard/updates:i";
+    // substitute blanks in name with underscore character
+    std::replace(name.begin(), name.end(), ' ', '_');
+
+    subscription.reset(new BlackBoardSubscription(name, serverName + "/updates:o"));
+    if(!subscription->_port.open(name))
+    {
+        yError() << "Unable to open port " << name;
+        return nullptr;
+    }
+    subscription->_port.useCallback(*subscription);
+    registry[key] = subscription;
+    return subscription;
+}
+
+BlackBoardSubscription::BlackBoardSubscription(const std::string &name, const std::string &remote) :
+    _name(name), _remote(remote)
+{ }
+
+BlackBoardSubscription::~BlackBoardSubscription()
+{
+    _port.interrupt();
+    _port.close();
+}
+
+bool BlackBoardSubscription::add(const std::string &pattern)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return ++_patterns[pattern] == 1;
+}
+
+bool BlackBoardSubscription::remove(const std::string &pattern)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _patterns.find(pattern);
+    if(it == _patterns.end() || --it->second > 0)
+        return false;
+
+    _patterns.erase(it);
+    // the targets still watched through other patterns are kept
+    for(auto entry = _cache.begin(); entry != _cache.end(); )
+        entry = matchesAny(entry->first) ? std::next(entry) : _cache.erase(entry);
+    return true;
+}
+
+std::vector<std::string> BlackBoardSubscription::patterns()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::string> ret;
+    for(const auto &pattern : _patterns)
+        ret.push_back(pattern.first);
+    return ret;
+}
+
+bool BlackBoardSubscription::connect()
+{
+    // several clients may find the subscription lost at the same time, only one connects it again
+    std::lock_guard<std::mutex> connectLock(_connectMutex);
+    if(connected())
+        return true;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _cache.clear();
+    }
+    return Network::connect(_remote, _name);
+}
+
+bool BlackBoardSubscription::isWatched(const std::string &target)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return matchesAny(target);
+}
+
+bool BlackBoardSubscription::matchesAny(const std::string &target) const
+{
+    for(const auto &watched : _patterns)
+    {
+        const std::string &pattern = watched.first;
+        if(!pattern.empty() && pattern.back() == '*')
+        {
+            if(target.compare(0, pattern.size()-1, pattern, 0, pattern.size()-1) == 0)
+                return true;
+        }
+        else if(pattern == target)
+            return true;
+    }
+    return false;
+}
+
+bool BlackBoardSubscription::find(const std::string &target, Property &data, std::int64_t &stamp)
+{
+    if(!connected())
+        return false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto cached = _cache.find(target);
+    if(cached == _cache.end() || !matchesAny(target))
+        return false;
+    data  = cached->second.data;
+    stamp = cached->second.stamp;
+    return true;
+}
+
+bool BlackBoardSubscription::findField(const std::string &target, const std::string &key, Value &value)
+{
+    if(!connected())
+        return false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto cached = _cache.find(target);
+    if(cached == _cache.end() || !matchesAny(target))
+        return false;
+    value = cached->second.data.check(key) ? cached->second.data.find(key) : Value();
+    return true;
+}
+
+void BlackBoardSubscription::merge(const std::string &target, const Property &datum)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto cached = _cache.find(target);
+    if(cached == _cache.end())
+        return;
+    mergeProperty(cached->second.data, datum);
+    cached->second.stamp = nextStamp();
+}
+
+void BlackBoardSubscription::put(const std::string &target, const std::string &key, const Value &value)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto cached = _cache.find(target);
+    if(cached == _cache.end())
+        return;
+    cached->second.data.put(key, value);
+    cached->second.stamp = nextStamp();
+}
+
+std::int64_t BlackBoardSubscription::nextStamp()
+{
+    static std::atomic<std::int64_t> lastStamp {0};
+    return ++lastStamp;
+}
+
+void BlackBoardSubscription::onRead(DataUpdate& msg)
+{
+    // updates of the patterns watched by other processes are received as well
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!matchesAny(msg.target))
+        return;
+
+    CachedData &cached = _cache[msg.target];
+    if(msg.version <= cached.version)
+        return;
+
+    if(msg.reset)
+        cached.data = msg.delta;
+    else
+        mergeProperty(cached.data, msg.delta);
+    cached.version = msg.version;
+    cached.stamp   = nextStamp();
+}
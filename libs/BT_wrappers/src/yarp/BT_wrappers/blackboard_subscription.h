@@ -0,0 +1,137 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file blackboard_subscription.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_BLACKBOARD_SUBSCRIPTION_H
+#define YARP_BT_MODULES_BLACKBOARD_SUBSCRIPTION_H
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <yarp/os/Value.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/BT_wrappers/DataUpdate.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The BlackBoardSubscription class  Updates of the watched targets of a blackboard, shared by all the
+ *                                          BlackBoardClients of a process.
+ *
+ * A single updates:i port per process and port prefix is connected to the updates:o port of the blackboard, so
+ * the updates are sent once per process, e.g. per BT engine, whatever the number of its nodes. The subscription keeps
+ * the copy of the watched targets and counts the clients watching each pattern: the blackboard is asked to
+ * watch a pattern by its first client, and to unwatch it by its last one. The name of the port identifies
+ * the subscriber towards the blackboard.
+ * The subscription does not talk to the blackboard itself: the BlackBoardClients send watch and unwatch
+ * through their RPC port, as told by add and remove.
+ */
+class BlackBoardSubscription : private yarp::os::TypedReaderCallback<yarp::BT_wrappers::DataUpdate>
+{
+public:
+    /**
+     * @brief of            Subscription to the blackboard <serverName> of the clients of this process with
+     *                      <portPrefix>, created at first use. Its port is named after the first client,
+     *                      <portPrefix> + "/" + <clientName> + "/blackboard/updates:i", and closed along with
+     *                      the last client releasing the subscription.
+     * @return              nullptr if the port cannot be opened
+     */
+    static std::shared_ptr<BlackBoardSubscription> of(const std::string &portPrefix, const std::string &clientName,
+                                                      const std::string &serverName);
+
+    ~BlackBoardSubscription();
+
+    BlackBoardSubscription(const BlackBoardSubscription&) = delete;
+    BlackBoardSubscription& operator=(const BlackBoardSubscription&) = delete;
+
+    // name of the subscriber, to be given to BlackBoardWrapper::watch and unwatch
+    const std::string& name() const { return _name; }
+
+    /**
+     * @brief add           One more client of this process watching <pattern>
+     * @return              true if it is the first one, and the blackboard has to be asked to watch it
+     */
+    bool add(const std::string &pattern);
+
+    /**
+     * @brief remove        One client less watching <pattern>
+     * @return              true if it was the last one, and the blackboard has to be asked to unwatch it
+     */
+    bool remove(const std::string &pattern);
+
+    // patterns watched by the clients of this process
+    std::vector<std::string> patterns();
+
+    bool connected() { return _port.getInputCount() > 0; }
+
+    /**
+     * @brief connect       Connect to the updates:o port of the blackboard, if not connected already.
+     *                      The copy of the watched targets is dropped, the updates received so far may have
+     *                      gaps: the clients have to watch all the patterns again.
+     */
+    bool connect();
+
+    bool isWatched(const std::string &target);
+
+    /**
+     * @brief find          Copy of the watched <target>
+     * @param stamp         set to the stamp of the content, see nextStamp
+     * @return              false if the target is not watched, or its content is not available
+     */
+    bool find(const std::string &target, yarp::os::Property &data, std::int64_t &stamp);
+
+    // as find, for the field <key> of <target>: a null Value if the target has no such field
+    bool findField(const std::string &target, const std::string &key, yarp::os::Value &value);
+
+    // Changes written by a client of this process, to be seen before the update comes back from the blackboard
+    void merge(const std::string &target, const yarp::os::Property &datum);
+    void put(const std::string &target, const std::string &key, const yarp::os::Value &value);
+
+    /**
+     * @brief nextStamp     Number identifying a content of a target, unique in the process: a new one is taken
+     *                      whenever the copy of a target held by a client or by a subscription changes.
+     */
+    static std::int64_t nextStamp();
+
+private:
+    BlackBoardSubscription(const std::string &name, const std::string &remote);
+
+    struct CachedData
+    {
+        yarp::os::Property  data;
+        std::int64_t        version {0};    // version of the last update applied
+        std::int64_t        stamp {0};      // see nextStamp
+    };
+
+    std::string                                             _name;
+    std::string                                             _remote;
+    yarp::os::BufferedPort<yarp::BT_wrappers::DataUpdate>   _port;
+
+    std::mutex                          _connectMutex;
+    std::mutex                          _mutex;
+    std::map<std::string, int>          _patterns;      // pattern -> number of clients watching it
+    std::map<std::string, CachedData>   _cache;
+
+    void onRead(yarp::BT_wrappers::DataUpdate& msg) override;
+
+    // to be called with _mutex held
+    bool matchesAny(const std::string &target) const;
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_BLACKBOARD_SUBSCRIPTION_H
@@ -0,0 +1,144 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file cancellation_token.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_CANCELLATION_TOKEN_H
+#define YARP_BT_MODULES_CANCELLATION_TOKEN_H
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The CancellationSource class  Halt state of a single action, owned by the TickServer.
+ *                                      Waiters on its tokens are woken up as soon as `cancel` is called.
+ */
+class CancellationSource
+{
+public:
+    void cancel()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cancelled = true;
+        }
+        _cv.notify_all();
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _cancelled = false;
+    }
+
+    bool isCancelled() const { return _cancelled; }
+
+private:
+    friend class CancellationToken;
+
+    std::atomic<bool>       _cancelled {false};
+    std::mutex              _mutex;
+    std::condition_variable _cv;
+};
+
+/**
+ * @brief The CancellationToken class   Handle given to user code to check for a halt request on an action
+ *                                      and to wait without delaying the halt.
+ *
+ * Replace polling loops like
+ * ```
+ *   while(!isHaltRequested(target)) { ... yarp::os::Time::delay(0.1); }
+ * ```
+ * with
+ * ```
+ *   auto token = getCancellationToken(target);
+ *   while(!token.isCancelled()) { ... token.waitFor(std::chrono::milliseconds(100)); }
+ * ```
+ * A default constructed token is never cancelled.
+ */
+class CancellationToken
+{
+public:
+    CancellationToken() = default;
+    explicit CancellationToken(CancellationSource *source) : _source(source) {}
+
+    /**
+     * @brief isCancelled   true if a halt has been requested for the action
+     */
+    bool isCancelled() const
+    {
+        return _source && _source->isCancelled();
+    }
+
+    /**
+     * @brief waitFor       Sleep for <duration>, or less if the action gets halted meanwhile.
+     * @return              true if the action has been halted, false if the whole duration elapsed
+     */
+    template <typename Rep, typename Period>
+    bool waitFor(const std::chrono::duration<Rep, Period> &duration) const
+    {
+        if(!_source)
+        {
+            std::this_thread::sleep_for(duration);
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(_source->_mutex);
+        return _source->_cv.wait_for(lock, duration, [this]{ return _source->isCancelled(); });
+    }
+
+    /**
+     * @brief waitFor       Same as above, duration in seconds like yarp::os::Time::delay.
+     */
+    bool waitFor(double seconds) const
+    {
+        return waitFor(std::chrono::duration<double>(seconds));
+    }
+
+    /**
+     * @brief waitUntil     Wait until <predicate> becomes true, checking it every <period>.
+     *                      The wait ends immediately if the action gets halted.
+     * @param predicate     condition to wait for, e.g. a remote status check
+     * @param timeout       max time to wait
+     * @param period        interval between two checks of the predicate
+     * @return              true if the predicate is satisfied, false on timeout or halt
+     *                      (use `isCancelled` to tell the two apart)
+     */
+    template <typename Predicate, typename Rep1, typename Period1, typename Rep2, typename Period2>
+    bool waitUntil(Predicate predicate,
+                   const std::chrono::duration<Rep1, Period1> &timeout,
+                   const std::chrono::duration<Rep2, Period2> &period) const
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while(!predicate())
+        {
+            auto now = std::chrono::steady_clock::now();
+            if(now >= deadline)
+                return false;
+            auto remaining = std::chrono::duration_cast<std::chrono::steady_clock::duration>(deadline - now);
+            auto step = std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+            if(waitFor(remaining < step ? remaining : step))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    CancellationSource *_source {nullptr};
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_CANCELLATION_TOKEN_H
@@ -0,0 +1,206 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file monitor_publisher.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "monitor_publisher.h"
+
+#include <chrono>
+#include <yarp/os/Bottle.h>
+#include <yarp/os/LogStream.h>
+
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+
+// How often the publisher checks for new monitor connections when idle
+static const std::chrono::milliseconds IDLE_PERIOD(100);
+
+MonitorPublisher::MonitorPublisher(size_t capacity)
+{
+    size_t size = 2;
+    while(size < capacity)
+        size <<= 1;
+    _mask = size - 1;
+    _ring = std::unique_ptr<Record[]>(new Record[size]);
+    for(size_t i=0; i<size; i++)
+    {
+        _ring[i].sequence.store(i, std::memory_order_relaxed);
+        _ring[i].event = nullptr;
+    }
+}
+
+MonitorPublisher::~MonitorPublisher()
+{
+    close();
+}
+
+bool MonitorPublisher::open(const std::string &portName, const std::string &skill)
+{
+    setSkill(skill);
+    if(!_port.open(portName))
+        return false;
+
+    _running = true;
+    _thread = std::thread(&MonitorPublisher::run, this);
+    return true;
+}
+
+void MonitorPublisher::close()
+{
+    if(_running.exchange(false))
+    {
+        {
+            std::lock_guard<std::mutex> lock(_wake_mutex);
+            _wake.notify_one();
+        }
+        _thread.join();
+    }
+    _port.interrupt();
+    _port.close();
+}
+
+void MonitorPublisher::setSkill(const std::string &skill)
+{
+    std::lock_guard<std::mutex> lock(_skill_mutex);
+    _skill = skill;
+}
+
+void MonitorPublisher::publish(const char *event)
+{
+    if(!_connected.load(std::memory_order_relaxed))
+    {
+        _discarded.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if(!push(event))
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // only the first event published while the thread is idle wakes it up
+    if(_waiting.exchange(false))
+    {
+        std::lock_guard<std::mutex> lock(_wake_mutex);
+        _wake.notify_one();
+    }
+}
+
+void MonitorPublisher::post(const char *event)
+{
+    if(!_connected.load(std::memory_order_relaxed))
+    {
+        _discarded.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if(!push(event))
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MonitorPublisher::push(const char *event)
+{
+    Record *record;
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    while(true)
+    {
+        record = &_ring[pos & _mask];
+        size_t seq = record->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if(diff == 0)
+        {
+            if(_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if(diff < 0)
+            return false;   // full
+        else
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+    }
+    record->event = event;
+    record->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool MonitorPublisher::pop(const char *&event)
+{
+    Record *record;
+    size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+    while(true)
+    {
+        record = &_ring[pos & _mask];
+        size_t seq = record->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if(diff == 0)
+        {
+            if(_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if(diff < 0)
+            return false;   // empty
+        else
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+    }
+    event = record->event;
+    record->sequence.store(pos + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+bool MonitorPublisher::empty() const
+{
+    return _dequeue_pos.load() == _enqueue_pos.load();
+}
+
+void MonitorPublisher::run()
+{
+    Bottle batch;
+    std::string skill;
+    const char *event;
+
+    while(_running)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_wake_mutex);
+            _waiting = true;
+            _wake.wait_for(lock, IDLE_PERIOD, [this] { return !_waiting || !_running || !empty(); });
+            _waiting = false;
+        }
+
+        _connected = (_port.getOutputCount() > 0);
+
+        {
+            std::lock_guard<std::mutex> lock(_skill_mutex);
+            skill = _skill;
+        }
+
+        // Write everything queued so far with a single message, one (skill target event) list per event
+        batch.clear();
+        while(pop(event))
+        {
+            if(!_connected)
+            {
+                _discarded++;
+                continue;
+            }
+            Bottle &msg = batch.addList();
+            msg.addString(skill);
+            msg.addString("");
+            msg.addString(event);
+        }
+
+        if(batch.size() > 0)
+        {
+            _port.write(batch);
+            _published += batch.size();
+            _batches++;
+        }
+    }
+}
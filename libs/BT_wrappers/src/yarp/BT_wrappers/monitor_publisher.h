@@ -0,0 +1,125 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file monitor_publisher.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_MONITOR_PUBLISHER_H
+#define YARP_BT_MODULES_MONITOR_PUBLISHER_H
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <condition_variable>
+
+#include <yarp/os/Port.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The MonitorPublisher class    Send monitoring events out of the tick path.
+ *
+ * `publish` only pushes a small fixed record into a lock-free ring buffer; a background
+ * thread drains the ring and writes all the records queued so far as a single message on
+ * the monitor port: a Bottle holding one (skill target event) list per record, i.e. the
+ * fields of a MonitorMsg, in the order they were published.
+ * The thread is woken up only by the first record published while it is idle, the
+ * following ones are collected by the same write.
+ * When nobody is connected to the port the records are discarded without being queued.
+ * If the monitors cannot keep up and the ring is full, records are dropped and counted.
+ */
+class MonitorPublisher
+{
+public:
+    explicit MonitorPublisher(size_t capacity = 1024);
+    ~MonitorPublisher();
+
+    MonitorPublisher(const MonitorPublisher&) = delete;
+    MonitorPublisher& operator=(const MonitorPublisher&) = delete;
+
+    /**
+     * @brief open          Open the monitor port and start the publishing thread.
+     * @param portName      full name of the port to open
+     * @param skill         value of the `skill` field of published messages
+     */
+    bool open(const std::string &portName, const std::string &skill);
+
+    /**
+     * @brief close         Stop the publishing thread and close the port. Pending records are lost.
+     */
+    void close();
+
+    /**
+     * @brief setSkill      Change the value of the `skill` field of the following messages.
+     */
+    void setSkill(const std::string &skill);
+
+    /**
+     * @brief publish       Queue an event. Lock-free, never blocks.
+     * @param event         name of the event; must be a string literal or in any case
+     *                      outlive the publisher, since only the pointer is stored.
+     */
+    void publish(const char *event);
+
+    /**
+     * @brief post          Queue an event without waking the publishing thread up. Lock-free, never
+     *                      blocks, never takes a mutex: for the tick path answered on the reader thread
+     *                      of the tick port. The event is written with the next batch, at the latest
+     *                      when the idle thread checks the ring again.
+     */
+    void post(const char *event);
+
+    std::uint64_t published() const { return _published; }     // events written on the port
+    std::uint64_t batches()   const { return _batches; }       // messages written on the port
+    std::uint64_t dropped()   const { return _dropped; }       // ring full, monitors not keeping up
+    std::uint64_t discarded() const { return _discarded; }     // no monitor connected
+
+private:
+    struct Record
+    {
+        std::atomic<size_t> sequence;
+        const char         *event;
+    };
+
+    bool push(const char *event);
+    bool pop(const char *&event);
+    bool empty() const;
+    void run();
+
+    // Bounded MPMC queue, see D. Vyukov "Bounded MPMC queue"
+    std::unique_ptr<Record[]>   _ring;
+    size_t                      _mask;
+    alignas(64) std::atomic<size_t> _enqueue_pos {0};
+    alignas(64) std::atomic<size_t> _dequeue_pos {0};
+
+    std::atomic<bool>           _connected {false};
+    std::atomic<bool>           _running {false};
+    std::atomic<bool>           _waiting {false};   // publishing thread idle, to be woken up
+    std::atomic<std::uint64_t>  _published {0};
+    std::atomic<std::uint64_t>  _batches {0};
+    std::atomic<std::uint64_t>  _dropped {0};
+    std::atomic<std::uint64_t>  _discarded {0};
+
+    std::string                 _skill;
+    std::mutex                  _skill_mutex;
+
+    std::mutex                  _wake_mutex;
+    std::condition_variable     _wake;
+    std::thread                 _thread;
+
+    yarp::os::Port              _port;
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_MONITOR_PUBLISHER_H
@@ -0,0 +1,107 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file property_merge.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "property_merge.h"
+
+#include <yarp/os/ConnectionReader.h>
+#include <yarp/os/ConnectionWriter.h>
+
+using namespace yarp::os;
+
+namespace yarp {
+namespace BT_wrappers {
+
+// Copy the value of a single entry into <dst>
+static void putEntry(Property &dst, const Value &line)
+{
+    Bottle *entry = line.asList();
+    if(!entry || entry->size() == 0)
+        return;
+
+    if(entry->size() != 2)
+    {
+        // not a plain key/value pair, e.g. a list of values: copy the whole line
+        dst.fromString(line.toString(), false);
+        return;
+    }
+    dst.put(entry->get(0).toString(), entry->get(1));
+}
+
+bool PropertyEntries::read(ConnectionReader& reader)
+{
+    _source = nullptr;
+    clear();
+    if(!_entries.read(reader))
+        return false;
+    for(size_t i=0; i<_entries.size(); i++)
+        putEntry(*this, _entries.get(i));
+    return true;
+}
+
+bool PropertyEntries::write(ConnectionWriter& writer) const
+{
+    return _source ? _source->write(writer) : Property::write(writer);
+}
+
+Bottle propertyEntries(const Property &prop)
+{
+    const PropertyEntries *received = dynamic_cast<const PropertyEntries*>(&prop);
+    if(received && received->source())
+        return Bottle(received->source()->toString());
+    if(received)
+        return received->entries();
+    return Bottle(prop.toString());
+}
+
+void mergeProperty(Property &dst, const Bottle &entries)
+{
+    for(size_t i=0; i<entries.size(); i++)
+        putEntry(dst, entries.get(i));
+}
+
+size_t valueBytes(const Value &value)
+{
+    if(value.isList())
+    {
+        size_t bytes = 0;
+        const Bottle *list = value.asList();
+        for(size_t i=0; i<list->size(); i++)
+            bytes += valueBytes(list->get(i));
+        return bytes;
+    }
+    if(value.isString())
+        return value.asString().size();
+    if(value.isBlob())
+        return value.asBlobLength();
+    return 8;
+}
+
+std::int64_t mergeGrowth(const Property &dst, const Bottle &entries)
+{
+    std::int64_t growth = 0;
+    for(size_t i=0; i<entries.size(); i++)
+    {
+        Bottle *entry = entries.get(i).asList();
+        if(!entry || entry->size() == 0)
+            continue;
+
+        // a line which is not a key/value pair is copied as a whole
+        std::string key = entry->get(0).toString();
+        growth += static_cast<std::int64_t>(entry->size() == 2 ? key.size() + valueBytes(entry->get(1))
+                                                                : valueBytes(entries.get(i)));
+        if(dst.check(key))
+            growth -= static_cast<std::int64_t>(key.size() + valueBytes(dst.find(key)));
+    }
+    return growth;
+}
+
+}}  // close namespaces
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file property_merge.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_PROPERTY_MERGE_H
+#define YARP_BT_MODULES_PROPERTY_MERGE_H
+
+#include <cstdint>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The PropertyEntries class     A Property read from the network that keeps the message it was read from.
+ *
+ * yarp::os::Property has no way to iterate over its keys, and reads a message by printing it and parsing the text.
+ * This class reads the message as it is, as one (key value ...) list per entry, and fills the Property by putting
+ * the entries one by one, so the merges can then visit the entries without any text conversion.
+ * It is the type of the data to merge in the BlackBoard interface (DataEntries in BlackBoard.thrift).
+ */
+class PropertyEntries : public yarp::os::Property
+{
+public:
+    PropertyEntries() = default;
+
+    /**
+     * @brief PropertyEntries   Refer to <prop> to write it on the network, as a plain Property, without copying it.
+     *                          For the clients, which pass a Property where the interface expects a PropertyEntries:
+     *                          <prop> must outlive this object and its copies, which are empty otherwise.
+     */
+    PropertyEntries(const yarp::os::Property &prop) : _source(&prop) {}
+
+    bool read(yarp::os::ConnectionReader& reader) override;
+    bool write(yarp::os::ConnectionWriter& writer) const override;
+
+    // entries as read from the network, empty if this object refers to another Property
+    const yarp::os::Bottle& entries() const { return _entries; }
+    const yarp::os::Property* source() const { return _source; }
+
+private:
+    yarp::os::Bottle            _entries;
+    const yarp::os::Property   *_source {nullptr};
+};
+
+/**
+ * @brief propertyEntries   List the entries of <prop>, one (key value ...) list each.
+ *                          Free for a PropertyEntries, the others go through the text of <prop>.
+ */
+yarp::os::Bottle propertyEntries(const yarp::os::Property &prop);
+
+/**
+ * @brief mergeProperty     Copy the <key, value> pairs of <src> into <dst>, in place.
+ *                          Pairs existing only in <dst> are kept as they are, the ones existing in both
+ *                          are overwritten by <src>.
+ * @param entries           the entries of <src>, as returned by propertyEntries
+ */
+void mergeProperty(yarp::os::Property &dst, const yarp::os::Bottle &entries);
+
+inline void mergeProperty(yarp::os::Property &dst, const yarp::os::Property &src)
+{
+    const PropertyEntries *received = dynamic_cast<const PropertyEntries*>(&src);
+    if(received && !received->source())
+        mergeProperty(dst, received->entries());
+    else
+        mergeProperty(dst, propertyEntries(src));
+}
+
+/**
+ * @brief valueBytes        Estimate of the memory used by <value>, computed from its structure: the size of strings
+ *                          and blobs, 8 bytes for each number and the sum of the elements for lists.
+ */
+size_t valueBytes(const yarp::os::Value &value);
+
+/**
+ * @brief mergeGrowth       Change of the estimated memory used by <dst> when <entries> are merged into it,
+ *                          as by mergeProperty. To be called before the merge.
+ */
+std::int64_t mergeGrowth(const yarp::os::Property &dst, const yarp::os::Bottle &entries);
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_PROPERTY_MERGE_H
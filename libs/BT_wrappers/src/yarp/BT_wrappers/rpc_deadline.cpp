@@ -0,0 +1,149 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file rpc_deadline.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "rpc_deadline.h"
+
+#include <algorithm>
+#include <yarp/os/Time.h>
+#include <yarp/os/LogStream.h>
+
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+
+constexpr double RpcDeadline::MIN_BACKOFF;
+constexpr double RpcDeadline::MAX_BACKOFF;
+constexpr double RpcDeadline::CONNECT_WAIT;
+
+void RpcDeadline::attach(Port &port, const std::string &remote)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _port   = &port;
+        _remote = remote;
+    }
+    setTimeout(_timeout);
+}
+
+bool RpcDeadline::connect(double maxWait)
+{
+    Port        *port;
+    std::string  remote;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        port   = _port;
+        remote = _remote;
+    }
+    if(!port || remote.empty())
+        return false;
+
+    double start   = Time::now();
+    double backoff = MIN_BACKOFF;
+    while(!port->addOutput(remote))
+    {
+        double now = Time::now();
+        if(now + backoff - start > maxWait)
+        {
+            yWarning() << "Cannot connect to " << remote << ", retrying in " << backoff << " s";
+            std::lock_guard<std::mutex> lock(_mutex);
+            _backoff   = backoff;
+            _retryTime = now + backoff;
+            return false;
+        }
+        Time::delay(backoff);
+        backoff = std::min(2 * backoff, MAX_BACKOFF);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _backoff = 0.0;
+    return true;
+}
+
+bool RpcDeadline::setTimeout(double seconds)
+{
+    _timeout = seconds > 0 ? seconds : 0.0;
+    // the port is attached on connection, the timeout is applied then
+    if(!_port)
+        return true;
+    // a negative timeout disables it on the port
+    return _port->setTimeout(_timeout > 0 ? static_cast<float>(_timeout.load()) : -1.0f);
+}
+
+bool RpcDeadline::begin()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_backoff == 0.0)
+        return true;
+
+    double now = Time::now();
+    if(now < _retryTime)
+    {
+        _fastFailures++;
+        return false;
+    }
+
+    // let this call through, the others fail fast until it is over
+    _retryTime = now + _backoff;
+
+    if(_port && !_remote.empty() && _port->getOutputCount() == 0)
+    {
+        if(!_port->addOutput(_remote))
+        {
+            _backoff   = std::min(2 * _backoff, MAX_BACKOFF);
+            _retryTime = now + _backoff;
+            _fastFailures++;
+            return false;
+        }
+        _reconnections++;
+        yInfo() << "Reconnected to " << _remote;
+    }
+    return true;
+}
+
+bool RpcDeadline::end(bool ok, double start)
+{
+    double now = Time::now();
+    bool lost    = (_port && _port->getOutputCount() == 0);
+    // a valid reply counts even if it came late, only a failed read can be due to the deadline
+    bool expired = (!ok || lost) && _timeout > 0 && now - start >= _timeout;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(ok && !lost)
+    {
+        _backoff = 0.0;
+        return true;
+    }
+
+    if(expired)
+        _expired++;
+
+    if(_backoff == 0.0)
+        yWarning() << "RPC to " << _remote << (expired ? " exceeded its deadline" : " failed") << ", retrying in " << MIN_BACKOFF << " s";
+
+    _backoff   = (_backoff == 0.0) ? MIN_BACKOFF : std::min(2 * _backoff, MAX_BACKOFF);
+    _retryTime = now + _backoff;
+    return false;
+}
+
+void RpcDeadline::toProperty(Property &prop) const
+{
+    prop.put("timeout",         Value(_timeout.load()));
+    prop.put("expired",         Value::makeInt64(_expired));
+    prop.put("fast_failures",   Value::makeInt64(_fastFailures));
+    prop.put("reconnections",   Value::makeInt64(_reconnections));
+}
+
+void RpcDeadline::resetCounters()
+{
+    _expired       = 0;
+    _fastFailures  = 0;
+    _reconnections = 0;
+}
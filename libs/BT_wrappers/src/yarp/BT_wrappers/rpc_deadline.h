@@ -0,0 +1,107 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file rpc_deadline.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_RPC_DEADLINE_H
+#define YARP_BT_MODULES_RPC_DEADLINE_H
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <cstdint>
+
+#include <yarp/os/Port.h>
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The RpcDeadline class     Deadline and fast failure for the RPCs of a client port.
+ *
+ * The timeout is applied to the port, so a call to a hung server returns after at most <timeout> seconds.
+ * When a call fails, either because the deadline expired or because the server is gone, next calls fail
+ * immediately without touching the network until a backoff period elapses; then the connection is
+ * restored if needed and a single call is let through. The backoff doubles at each consecutive failure,
+ * from 0.1 up to 5 seconds, and is cleared by the first successful call.
+ */
+class RpcDeadline
+{
+public:
+    /**
+     * @brief attach        Port the RPCs are sent on, and remote port to connect to when reconnecting
+     */
+    void attach(yarp::os::Port &port, const std::string &remote);
+
+    /**
+     * @brief connect       Connect the port to the remote one, retrying with the same backoff used after a failure,
+     *                      e.g. while the server is still starting.
+     * @param maxWait       give up after this time, in seconds. Calls are then treated as after a failure,
+     *                      the connection is tried again by next begin once the backoff elapsed.
+     * @return              true if connected
+     */
+    bool connect(double maxWait = CONNECT_WAIT);
+
+    /**
+     * @brief setTimeout    Max time to wait for a reply, in seconds. Zero or negative waits forever.
+     *                      Better set before connect, so that the very first call is bounded.
+     */
+    bool setTimeout(double seconds);
+    double getTimeout() const { return _timeout; }
+
+    /**
+     * @brief begin         To be called before each RPC.
+     * @return              false if the call must fail immediately, because the server failed recently
+     *                      or the connection cannot be restored
+     */
+    bool begin();
+
+    /**
+     * @brief end           To be called after each RPC.
+     * @param ok            false if the reply is known to be invalid
+     * @param start         time the RPC started, from yarp::os::Time::now()
+     * @return              false if the call failed, i.e. !ok or connection lost. The failure is counted as an
+     *                      expired deadline if the call lasted longer than the timeout.
+     */
+    bool end(bool ok, double start);
+
+    std::uint64_t expired() const       { return _expired; }
+    std::uint64_t fastFailures() const  { return _fastFailures; }
+    std::uint64_t reconnections() const { return _reconnections; }
+
+    /**
+     * @brief toProperty    Write timeout and counters into <prop>
+     */
+    void toProperty(yarp::os::Property &prop) const;
+
+    void resetCounters();
+
+private:
+    static constexpr double MIN_BACKOFF = 0.1;
+    static constexpr double MAX_BACKOFF = 5.0;
+    static constexpr double CONNECT_WAIT = 5.0;
+
+    yarp::os::Port *_port {nullptr};
+    std::string     _remote;
+    std::atomic<double> _timeout {0.0};
+
+    std::mutex      _mutex;
+    double          _backoff {0.0};         // 0 when the last call succeeded
+    double          _retryTime {0.0};       // calls before this time fail immediately
+
+    std::atomic<std::uint64_t>  _expired {0};
+    std::atomic<std::uint64_t>  _fastFailures {0};
+    std::atomic<std::uint64_t>  _reconnections {0};
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_RPC_DEADLINE_H
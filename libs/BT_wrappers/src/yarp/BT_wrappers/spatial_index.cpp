@@ -0,0 +1,262 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file spatial_index.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "spatial_index.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include <yarp/os/Bottle.h>
+
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+
+static bool isNumber(const Value &value)
+{
+    return value.isFloat64() || value.isInt32() || value.isInt64();
+}
+
+static bool nearer(const SpatialIndex::Match &a, const SpatialIndex::Match &b)
+{
+    return a.distance < b.distance;
+}
+
+SpatialIndex::SpatialIndex(double cellSize) :
+    _cellSize(cellSize > 0.0 ? cellSize : 1.0)
+{
+}
+
+bool SpatialIndex::positionOf(const Property &data, std::string &mapId, double position[3])
+{
+    Value &pose = data.find("pose");
+    if(pose.isList() && pose.asList()->size() >= 3)
+    {
+        Bottle *xyz = pose.asList();
+        for(size_t i=0; i<3; i++)
+        {
+            if(!isNumber(xyz->get(i)))
+                return false;
+            position[i] = xyz->get(i).asFloat64();
+        }
+        mapId = data.check("map_id") ? data.find("map_id").asString() : std::string();
+        return true;
+    }
+
+    Bottle &location = data.findGroup("location");
+    if(!location.isNull() && isNumber(location.find("x")) && isNumber(location.find("y")))
+    {
+        mapId       = location.find("map_id").asString();
+        position[0] = location.find("x").asFloat64();
+        position[1] = location.find("y").asFloat64();
+        position[2] = isNumber(location.find("z")) ? location.find("z").asFloat64() : 0.0;
+        return true;
+    }
+    return false;
+}
+
+bool SpatialIndex::isPositionKey(const std::string &key)
+{
+    return key == "pose" || key == "location" || key == "map_id";
+}
+
+bool SpatialIndex::movesTarget(const Property &delta)
+{
+    return delta.check("pose") || delta.check("location") || delta.check("map_id");
+}
+
+SpatialIndex::Cell SpatialIndex::cellOf(const double position[3]) const
+{
+    return Cell{static_cast<std::int64_t>(std::floor(position[0] / _cellSize)),
+                static_cast<std::int64_t>(std::floor(position[1] / _cellSize)),
+                static_cast<std::int64_t>(std::floor(position[2] / _cellSize))};
+}
+
+void SpatialIndex::update(const std::string &target, const Property &data)
+{
+    std::string mapId;
+    double position[3];
+    bool positioned = positionOf(data, mapId, position);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    removeLocked(target);
+    if(!positioned)
+        return;
+
+    Cell cell = cellOf(position);
+    Grid &grid = _grids[mapId];
+    if(grid.cells.empty())
+        grid.min = grid.max = cell;
+    grid.min = Cell{std::min(grid.min.x, cell.x), std::min(grid.min.y, cell.y), std::min(grid.min.z, cell.z)};
+    grid.max = Cell{std::max(grid.max.x, cell.x), std::max(grid.max.y, cell.y), std::max(grid.max.z, cell.z)};
+    grid.cells[cell].push_back(Point{target, {position[0], position[1], position[2]}});
+    _locations[target] = Location{mapId, cell};
+}
+
+void SpatialIndex::remove(const std::string &target)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    removeLocked(target);
+}
+
+void SpatialIndex::removeLocked(const std::string &target)
+{
+    auto location = _locations.find(target);
+    if(location == _locations.end())
+        return;
+
+    auto grid = _grids.find(location->second.mapId);
+    auto cell = grid->second.cells.find(location->second.cell);
+    std::vector<Point> &points = cell->second;
+    points.erase(std::find_if(points.begin(), points.end(), [&](const Point &point) { return point.target == target; }));
+    if(points.empty())
+        grid->second.cells.erase(cell);
+    if(grid->second.cells.empty())
+        _grids.erase(grid);
+    _locations.erase(location);
+}
+
+void SpatialIndex::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _grids.clear();
+    _locations.clear();
+}
+
+void SpatialIndex::collect(const std::vector<Point> &points, const double center[3], std::vector<Match> &matches)
+{
+    for(const auto &point : points)
+    {
+        double dx = point.position[0] - center[0];
+        double dy = point.position[1] - center[1];
+        double dz = point.position[2] - center[2];
+        matches.push_back(Match{point.target, std::sqrt(dx*dx + dy*dy + dz*dz)});
+    }
+}
+
+std::vector<SpatialIndex::Match> SpatialIndex::inRadius(const std::string &mapId, const double center[3], double radius) const
+{
+    std::vector<Match> matches;
+    if(radius < 0.0)
+        return matches;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _grids.find(mapId);
+    if(found == _grids.end())
+        return matches;
+    const Grid &grid = found->second;
+
+    double low[3]  = {center[0] - radius, center[1] - radius, center[2] - radius};
+    double high[3] = {center[0] + radius, center[1] + radius, center[2] + radius};
+    Cell from = cellOf(low);
+    Cell to   = cellOf(high);
+    from = Cell{std::max(from.x, grid.min.x), std::max(from.y, grid.min.y), std::max(from.z, grid.min.z)};
+    to   = Cell{std::min(to.x, grid.max.x), std::min(to.y, grid.max.y), std::min(to.z, grid.max.z)};
+
+    if(from.x <= to.x && from.y <= to.y && from.z <= to.z)
+    {
+        // visit the cells of the box around the sphere, or the cells used if they are fewer
+        double boxCells = double(to.x - from.x + 1) * double(to.y - from.y + 1) * double(to.z - from.z + 1);
+        if(boxCells <= grid.cells.size())
+        {
+            for(std::int64_t x=from.x; x<=to.x; x++)
+                for(std::int64_t y=from.y; y<=to.y; y++)
+                    for(std::int64_t z=from.z; z<=to.z; z++)
+                    {
+                        auto cell = grid.cells.find(Cell{x, y, z});
+                        if(cell != grid.cells.end())
+                            collect(cell->second, center, matches);
+                    }
+        }
+        else
+        {
+            for(const auto &cell : grid.cells)
+            {
+                if(cell.first.x >= from.x && cell.first.x <= to.x &&
+                   cell.first.y >= from.y && cell.first.y <= to.y &&
+                   cell.first.z >= from.z && cell.first.z <= to.z)
+                    collect(cell.second, center, matches);
+            }
+        }
+    }
+
+    matches.erase(std::remove_if(matches.begin(), matches.end(), [&](const Match &match) { return match.distance > radius; }),
+                  matches.end());
+    std::sort(matches.begin(), matches.end(), nearer);
+    return matches;
+}
+
+std::vector<SpatialIndex::Match> SpatialIndex::nearest(const std::string &mapId, const double center[3], size_t count) const
+{
+    std::vector<Match> matches;
+    if(count == 0)
+        return matches;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _grids.find(mapId);
+    if(found == _grids.end())
+        return matches;
+    const Grid &grid = found->second;
+
+    // Visit the shells of cells around the one of <center>, i.e. the cells at distance r from it along
+    // some axis. The targets in the shells not visited yet are farther than r cells, so the search stops
+    // as soon as <count> targets are found within that distance, or when all the grid has been visited.
+    Cell c = cellOf(center);
+    bool complete = false;
+    for(std::int64_t r=0; ; r++)
+    {
+        // visiting the shell would cost more than looking at all the cells used
+        double side = double(2*r + 1);
+        if(side*side*side > 2.0 * grid.cells.size())
+            break;
+
+        for(std::int64_t dx=-r; dx<=r; dx++)
+            for(std::int64_t dy=-r; dy<=r; dy++)
+            {
+                bool onFace = (dx == -r || dx == r || dy == -r || dy == r);
+                std::int64_t step = onFace ? 1 : std::max<std::int64_t>(2*r, 1);
+                for(std::int64_t dz=-r; dz<=r; dz+=step)
+                {
+                    auto cell = grid.cells.find(Cell{c.x + dx, c.y + dy, c.z + dz});
+                    if(cell != grid.cells.end())
+                        collect(cell->second, center, matches);
+                }
+            }
+
+        if(matches.size() >= count)
+        {
+            std::nth_element(matches.begin(), matches.begin() + (count - 1), matches.end(), nearer);
+            if(matches[count - 1].distance <= r * _cellSize)
+            {
+                complete = true;
+                break;
+            }
+        }
+        if(c.x - r <= grid.min.x && c.y - r <= grid.min.y && c.z - r <= grid.min.z &&
+           c.x + r >= grid.max.x && c.y + r >= grid.max.y && c.z + r >= grid.max.z)
+        {
+            complete = true;
+            break;
+        }
+    }
+
+    if(!complete)
+    {
+        matches.clear();
+        for(const auto &cell : grid.cells)
+            collect(cell.second, center, matches);
+    }
+
+    count = std::min(count, matches.size());
+    std::partial_sort(matches.begin(), matches.begin() + count, matches.end(), nearer);
+    matches.resize(count);
+    return matches;
+}
@@ -0,0 +1,133 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file spatial_index.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_SPATIAL_INDEX_H
+#define YARP_BT_MODULES_SPATIAL_INDEX_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include <yarp/os/Property.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The SpatialIndex class    Index of the targets of the blackboard carrying a position.
+ *
+ * A target has a position if it contains either:
+ * - (pose (x y z)), as written for the objects located, with an optional (map_id name);
+ * - (location (map_id name) (x x) (y y)), as used for navigation, with an optional (z z).
+ *
+ * Each map_id has its own uniform grid of cubic cells, so that a query visits only the cells around
+ * the point asked for instead of all the targets. Thread safe.
+ */
+class SpatialIndex
+{
+public:
+    struct Match
+    {
+        std::string target;
+        double      distance;
+    };
+
+    /**
+     * @param cellSize      edge of the cells of the grid, in the unit of the positions. Queries are fastest
+     *                      when it is close to the usual radius asked for.
+     */
+    explicit SpatialIndex(double cellSize = 1.0);
+
+    /**
+     * @brief positionOf    Position carried by <data>, if any
+     * @return              false if <data> has no position
+     */
+    static bool positionOf(const yarp::os::Property &data, std::string &mapId, double position[3]);
+
+    /**
+     * @brief isPositionKey true if setting the field <key> of a target may change its position
+     */
+    static bool isPositionKey(const std::string &key);
+
+    /**
+     * @brief movesTarget   true if merging <delta> into a target may change its position
+     */
+    static bool movesTarget(const yarp::os::Property &delta);
+
+    /**
+     * @brief update        Index <target> at the position carried by <data>, or remove it if there is none
+     */
+    void update(const std::string &target, const yarp::os::Property &data);
+    void remove(const std::string &target);
+    void clear();
+
+    /**
+     * @brief inRadius      Targets of <mapId> within <radius> of <center>, the nearest first
+     */
+    std::vector<Match> inRadius(const std::string &mapId, const double center[3], double radius) const;
+
+    /**
+     * @brief nearest       The <count> targets of <mapId> nearest to <center>, the nearest first
+     */
+    std::vector<Match> nearest(const std::string &mapId, const double center[3], size_t count) const;
+
+private:
+    struct Cell
+    {
+        std::int64_t x, y, z;
+        bool operator==(const Cell &other) const { return x == other.x && y == other.y && z == other.z; }
+    };
+
+    struct CellHash
+    {
+        size_t operator()(const Cell &cell) const
+        {
+            return std::hash<std::int64_t>{}(cell.x * 73856093 ^ cell.y * 19349663 ^ cell.z * 83492791);
+        }
+    };
+
+    struct Point
+    {
+        std::string target;
+        double      position[3];
+    };
+
+    struct Grid
+    {
+        std::unordered_map<Cell, std::vector<Point>, CellHash>  cells;
+        Cell    min {0, 0, 0};  // bounds of the cells used since the grid was created
+        Cell    max {0, 0, 0};
+    };
+
+    struct Location
+    {
+        std::string mapId;
+        Cell        cell;
+    };
+
+    double                                      _cellSize;
+    mutable std::mutex                          _mutex;
+    std::map<std::string, Grid>                 _grids;     // map_id -> grid
+    std::unordered_map<std::string, Location>   _locations; // target -> where it is indexed
+
+    Cell cellOf(const double position[3]) const;
+    void removeLocked(const std::string &target);
+
+    static void collect(const std::vector<Point> &points, const double center[3], std::vector<Match> &matches);
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_SPATIAL_INDEX_H
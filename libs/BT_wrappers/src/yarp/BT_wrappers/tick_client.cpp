@@ -13,26 +13,35 @@
 
 #include "tick_client.h"
 
+#include <chrono>
 #include <memory>
 #include <iostream>
 #include <algorithm>
+#include <yarp/os/Time.h>
+#include <yarp/os/Network.h>
 #include <yarp/os/LogStream.h>
-#include <yarp/os/PortablePair.h>
-#include <yarp/BT_wrappers/MonitorMsg.h>
 
 using namespace std;
 using namespace yarp::os;
 using namespace yarp::BT_wrappers;
 
-TickClient::TickClient() : BT_request()
+// When subscribed, a running action is checked with an RPC at least this often (seconds),
+// in case a completion message gets lost
+static const double STATUS_REFRESH_PERIOD = 1.0;
+
+TickClient::TickClient() : BT_request(), _statusCache(64), _handles(64)
 {
     status_ = BT_IDLE;
 }
 
 TickClient::~TickClient()
 {
+    _asyncWorker.stop();
     _requestPort.close();
-    _toMonitor_port.close();
+    _monitor.close();
+
+    _statusPort.interrupt();
+    _statusPort.close();
 }
 
 bool TickClient::configure_TickClient(std::string portPrefix, std::string clientName)
@@ -55,7 +64,7 @@ bool TickClient::configure_TickClient(std::string portPrefix, std::string client
     }
 
     std::string monitorPort_name = portPrefix + "/" + clientName + "/monitor:o";
-    ret = _toMonitor_port.open(monitorPort_name);
+    ret = _monitor.open(monitorPort_name, _serverName);
 
     if(!ret)
         _requestPort.close();
@@ -66,41 +75,290 @@ bool TickClient::configure_TickClient(std::string portPrefix, std::string client
 }
 
 // This is useful to make sure all clients and servers have a matching suffix
-bool TickClient::connect(std::string serverName)
+bool TickClient::connect(std::string serverName, bool subscribeStatus)
 {
     _serverName = serverName;
-    return _requestPort.addOutput(serverName + "/tick:i");
+    _monitor.setSkill(_serverName);
+    // from now on, lost connections are restored when the server is contacted again
+    _deadline.attach(_requestPort, serverName + "/tick:i");
+    if(!_deadline.connect())
+        return false;
+
+    if(subscribeStatus)
+    {
+        std::string statusPort_name = _portPrefix + "/" + _clientName + "/status:i";
+        std::replace(statusPort_name.begin(), statusPort_name.end(), ' ', '_');
+
+        if(_statusPort.getName().empty())
+        {
+            if(!_statusPort.open(statusPort_name))
+            {
+                yError() << _clientName << ": Unable to open port " << statusPort_name;
+                return false;
+            }
+            _statusPort.useCallback(*this);
+        }
+
+        // Only threaded servers publish their status, fall back to plain RPCs for the others
+        if(!Network::connect(serverName + "/status:o", statusPort_name))
+        {
+            yDebug() << _clientName << ": server " << serverName << " does not publish its status, every tick will be sent to the server";
+            return true;
+        }
+        _subscribed = true;
+    }
+    return true;
 }
 
-ReturnStatus TickClient::request_tick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params)
+bool TickClient::registerTarget(const ActionID &target)
 {
-    // Propagate message to the monitor
-    {   // additional scope, to cleanup the variables afterward
-        yarp::os::PortablePair<yarp::BT_wrappers::MonitorMsg, Bottle> monitor;
-        MonitorMsg &msg = monitor.head;
-        msg = monitor.head;
-        msg.skill     = _serverName;
-        msg.event     = "e_from_bt";
-        _toMonitor_port.write(monitor);
+    std::lock_guard<std::mutex> lock(_handlesMutex);
+    TargetHandle *entry = _handles.findOrInsert(target.action_ID);
+    if(!entry)
+        return false;
+
+    // servers not supporting handles fail the call, leaving the default value 0
+    entry->target = target;
+    entry->epoch  = _deadline.reconnections();
+    entry->acked  = false;
+    entry->handle = BT_request::register_target(target);
+    if(entry->handle <= 0)
+    {
+        entry->handle = 0;
+        yDebug() << _clientName << ": server " << _serverName << " does not support handles, sending full ActionIDs";
+        return false;
+    }
+    return true;
+}
+
+std::int32_t TickClient::handleOf(const ActionID &target)
+{
+    std::lock_guard<std::mutex> lock(_handlesMutex);
+    TargetHandle *entry = _handles.find(target.action_ID);
+    if(!entry || entry->handle == 0 ||
+       entry->target.target != target.target || entry->target.resources != target.resources)
+        return 0;
+
+    // the server may have been restarted meanwhile, losing its handles
+    if(entry->epoch != _deadline.reconnections())
+    {
+        entry->epoch  = _deadline.reconnections();
+        entry->acked  = false;
+        entry->handle = std::max(BT_request::register_target(target), 0);
+    }
+    return entry->handle;
+}
+
+ReturnStatus TickClient::tickVersioned(std::int32_t handle, const ActionID &target, const Property &params, std::int64_t version)
+{
+    // params of an unknown version are always sent, the others only once per version
+    bool acked = false;
+    if(version != 0)
+    {
+        std::lock_guard<std::mutex> lock(_handlesMutex);
+        TargetHandle *entry = _handles.find(target.action_ID);
+        acked = entry && entry->acked && entry->acked_version == version;
+    }
+
+    TickReply reply = acked ? BT_request::tick_versioned(handle, version, false, Property())
+                            : BT_request::tick_versioned(handle, version, true, params);
+
+    // the server lost the params, e.g. it was restarted with the same handles
+    if(reply.params_needed)
+    {
+        acked = false;
+        reply = BT_request::tick_versioned(handle, version, true, params);
+    }
+    else if(acked)
+        _paramsSkipped++;
+
+    // a failed RPC leaves the status at BT_IDLE, the params are sent again next time
+    if(reply.status != BT_IDLE && reply.status != BT_ERROR && !acked)
+    {
+        std::lock_guard<std::mutex> lock(_handlesMutex);
+        TargetHandle *entry = _handles.find(target.action_ID);
+        if(entry && entry->handle == handle)
+        {
+            entry->acked         = true;
+            entry->acked_version = version;
+        }
     }
+    return reply.status;
+}
+
+bool TickClient::setTimeout(double seconds)
+{
+    return _deadline.setTimeout(seconds);
+}
+
+bool TickClient::needsRemoteTick(const yarp::BT_wrappers::ActionID &target) const
+{
+    if(!_subscribed)
+        return true;
+
+    // Action still running and server did not notify its completion yet: no need to ask
+    // A halt still queued makes the cached status stale
+    const CachedStatus *cached = _statusCache.find(target.action_ID);
+    return !(cached && cached->status == BT_RUNNING && cached->pending_halts == 0 &&
+             cached->notifications.load() == cached->notifications_at_tick.load() &&
+             Time::now() - cached->last_tick_time < STATUS_REFRESH_PERIOD);
+}
+
+void TickClient::onRead(ActionStatus& msg)
+{
+    // only counted: next tick of the action is sent to the server, which replies with the final status
+    CachedStatus *cached = _statusCache.findOrInsert(msg.action_ID);
+    if(cached)
+        cached->notifications++;
+}
+
+ReturnStatus TickClient::request_tick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params)
+{
+    return request_tick(target, params, 0);
+}
+
+ReturnStatus TickClient::request_tick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params, std::int64_t paramsVersion)
+{
+    if(!needsRemoteTick(target))
+        return localTick();
+    return remoteTick(target, params, paramsVersion);
+}
+
+ReturnStatus TickClient::localTick()
+{
+    status_ = BT_RUNNING;
+    _counters.countTick();
+    _counters.countReply(BT_RUNNING);
+    _localTicks++;
+    return status_;
+}
+
+ReturnStatus TickClient::remoteTick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params, std::int64_t paramsVersion)
+{
+    CachedStatus *cached = _subscribed ? _statusCache.findOrInsert(target.action_ID) : nullptr;
 
-    yInfo() << "\tCalling tick on target <" + target.target + "> with param <" + params.toString() + "> to remote server <" + _serverName + ">";
-    // Send the actual message to the server
-    status_ = BT_request::request_tick(target, params);
+    // Server failed recently, do not wait for it again
+    if(!_deadline.begin())
+    {
+        status_ = BT_FAILURE;
+        _counters.countTick();
+        _counters.countReply(BT_FAILURE);
+        return status_;
+    }
 
     // Propagate message to the monitor
-    {   // additional scope, to cleanup the variables afterward
-        yarp::os::PortablePair<yarp::BT_wrappers::MonitorMsg, Bottle> monitor;
-        MonitorMsg &msg = monitor.head;
-        msg = monitor.head;
-        msg.skill     = _serverName;
-        msg.event     = "e_to_bt";
-        _toMonitor_port.write(monitor);
+    _monitor.publish("e_from_bt");
+
+    if(_verbose)
+        yInfo() << "\tCalling tick on target <" + target.target + "> with param <" + params.toString() + "> to remote server <" + _serverName + ">";
+    // Send the actual message to the server.
+    // A completion received while waiting for the reply will trigger a new RPC on next tick
+    std::int64_t notifications = cached ? cached->notifications.load() : 0;
+    auto start = std::chrono::steady_clock::now();
+    double startTime = Time::now();
+    std::int32_t handle = handleOf(target);
+    status_ = handle ? tickVersioned(handle, target, params, paramsVersion) : BT_request::request_tick(target, params);
+    _rttLatency.record(std::chrono::steady_clock::now() - start);
+    // a failed RPC leaves the reply at its default value, BT_IDLE, which servers never reply to a tick
+    if(!_deadline.end(status_ != BT_IDLE, startTime))
+        status_ = BT_FAILURE;
+    _counters.countTick();
+    _counters.countReply(status_);
+    if(cached)
+    {
+        cached->notifications_at_tick = notifications;
+        cached->last_tick_time = Time::now();
+        cached->status = status_.load();
     }
 
+    // Propagate message to the monitor
+    _monitor.publish("e_to_bt");
+
     return status_;
 }
 
+std::future<ReturnStatus> TickClient::request_tick_async(const ActionID &target, const Property &params)
+{
+    return request_tick_async(target, [params]{ return params; });
+}
+
+std::future<ReturnStatus> TickClient::request_tick_async(const ActionID &target, std::function<Property()> getParams)
+{
+    return request_tick_async(target, [getParams](std::int64_t &) { return getParams(); });
+}
+
+std::future<ReturnStatus> TickClient::request_tick_async(const ActionID &target, std::function<Property(std::int64_t &)> getParams)
+{
+    // Answered locally, no need to involve the worker.
+    // Otherwise the tick is sent whatever happens meanwhile, along with the params computed for it
+    if(!needsRemoteTick(target))
+    {
+        std::promise<ReturnStatus> local;
+        local.set_value(localTick());
+        return local.get_future();
+    }
+
+    // a request discarded because the client is closing fails without being sent
+    std::future<ReturnStatus> result;
+    runAsync([this, target, getParams](bool discarded)
+             {
+                 if(discarded)
+                     return BT_FAILURE;
+                 // unknown unless the getter tells it
+                 std::int64_t version = 0;
+                 Property params = getParams(version);
+                 return remoteTick(target, params, version);
+             }, result);
+    return result;
+}
+
+std::future<ReturnStatus> TickClient::request_halt_async(const ActionID &target, std::function<Property()> getParams)
+{
+    // until the halt is sent, ticks of <target> must not be answered from the cached status
+    CachedStatus *cached = _subscribed ? _statusCache.findOrInsert(target.action_ID) : nullptr;
+    if(cached)
+        cached->pending_halts++;
+
+    std::future<ReturnStatus> result;
+    bool queued = runAsync([this, target, getParams, cached](bool discarded)
+                           {
+                               ReturnStatus ret = discarded ? BT_FAILURE : request_halt(target, getParams());
+                               if(cached)
+                                   cached->pending_halts--;
+                               return ret;
+                           }, result);
+    if(!queued && cached)
+        cached->pending_halts--;
+    return result;
+}
+
+bool TickClient::runAsync(std::function<ReturnStatus(bool)> request, std::future<ReturnStatus> &result)
+{
+    {
+        std::lock_guard<std::mutex> lock(_asyncMutex);
+        if(_asyncWorker.poolSize() == 0 && !_asyncWorker.start(1, 16, true))
+        {
+            yError() << _clientName << ": unable to start the thread for asynchronous requests";
+            std::promise<ReturnStatus> failed;
+            failed.set_value(BT_ERROR);
+            result = failed.get_future();
+            return false;
+        }
+    }
+
+    auto job = std::make_shared<std::packaged_task<ReturnStatus(bool)>>(std::move(request));
+    result = job->get_future();
+    if(!_asyncWorker.submit([job]{ (*job)(false); }, [job]{ (*job)(true); }))
+    {
+        yError() << _clientName << ": too many asynchronous requests pending for server " << _serverName;
+        std::promise<ReturnStatus> rejected;
+        rejected.set_value(BT_ERROR);
+        result = rejected.get_future();
+        return false;
+    }
+    return true;
+}
+
 ReturnStatus TickClient::request_halt(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params)
 {
     if(status_ == BT_RUNNING)
@@ -109,16 +367,102 @@ ReturnStatus TickClient::request_halt(const yarp::BT_wrappers::ActionID &target,
 //        propagateCmd(BT_HALT);
 
         //I need halt the node
-        return BT_request::request_halt(target, params);
+        if(!_deadline.begin())
+            return BT_FAILURE;
+        auto start = std::chrono::steady_clock::now();
+        double startTime = Time::now();
+        std::int32_t handle = handleOf(target);
+        ReturnStatus ret = handle ? BT_request::halt_handle(handle, params) : BT_request::request_halt(target, params);
+        _haltLatency.record(std::chrono::steady_clock::now() - start);
+        if(!_deadline.end(true, startTime))
+            ret = BT_FAILURE;
+        _counters.countHalt();
+        CachedStatus *cached = _statusCache.find(target.action_ID);
+        if(cached)
+            cached->status = ret;
+        return ret;
 
         // Propagate reply to the monitor
 //        propagateReply(BT_HALT, status_);
     }
+    return status_;
+}
+
+std::vector<ReturnStatus> TickClient::request_batch_tick(const std::vector<ActionID> &targets, const std::vector<Property> &params)
+{
+    // Server failed recently, do not wait for it again
+    if(!_deadline.begin())
+    {
+        for(size_t i=0; i<targets.size(); i++)
+        {
+            _counters.countTick();
+            _counters.countReply(BT_FAILURE);
+        }
+        return std::vector<ReturnStatus>(targets.size(), BT_FAILURE);
+    }
+
+    // Propagate message to the monitor
+    _monitor.publish("e_from_bt");
+
+    auto start = std::chrono::steady_clock::now();
+    double startTime = Time::now();
+    std::vector<ReturnStatus> ret = BT_request::request_batch_tick(targets, params);
+    _rttLatency.record(std::chrono::steady_clock::now() - start);
+
+    if(!_deadline.end(ret.size() == targets.size(), startTime))
+    {
+        yError() << _clientName << ": batch tick of " << targets.size() << " actions to server " << _serverName << " failed";
+        ret.assign(targets.size(), BT_FAILURE);
+    }
+
+    for(size_t i=0; i<targets.size(); i++)
+    {
+        _counters.countTick();
+        _counters.countReply(ret[i]);
+        CachedStatus *cached = _subscribed ? _statusCache.findOrInsert(targets[i].action_ID) : nullptr;
+        if(cached)
+        {
+            cached->notifications_at_tick = cached->notifications.load();
+            cached->last_tick_time = Time::now();
+            cached->status = ret[i];
+        }
+    }
+
+    // Propagate message to the monitor
+    _monitor.publish("e_to_bt");
+
+    return ret;
 }
 
 ReturnStatus TickClient::request_status(const yarp::BT_wrappers::ActionID &target)
 {
-    return BT_request::request_status(target);
+    std::int32_t handle = handleOf(target);
+    return handle ? BT_request::status_handle(handle) : BT_request::request_status(target);
+}
+
+Property TickClient::getStats() const
+{
+    Property stats;
+    _counters.toProperty(stats);
+    stats.put("local_ticks", Value::makeInt64(_localTicks));
+    stats.put("params_skipped", Value::makeInt64(_paramsSkipped));
+    _rttLatency.toProperty(stats.addGroup("rtt_us"));
+    _haltLatency.toProperty(stats.addGroup("halt_us"));
+    _deadline.toProperty(stats.addGroup("rpc"));
+    stats.put("monitor_published",  Value::makeInt64(_monitor.published()));
+    stats.put("monitor_batches",    Value::makeInt64(_monitor.batches()));
+    stats.put("monitor_dropped",    Value::makeInt64(_monitor.dropped()));
+    return stats;
+}
+
+void TickClient::resetStats()
+{
+    _counters.reset();
+    _localTicks = 0;
+    _paramsSkipped = 0;
+    _rttLatency.reset();
+    _haltLatency.reset();
+    _deadline.resetCounters();
 }
 
 bool TickClient::request_initialize()
@@ -16,14 +16,24 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <future>
+#include <functional>
 
 #include <yarp/os/Port.h>
+#include <yarp/os/BufferedPort.h>
 #include <yarp/BT_wrappers/BT_request.h>
+#include <yarp/BT_wrappers/ActionStatus.h>
+#include <yarp/BT_wrappers/action_table.h>
+#include <yarp/BT_wrappers/worker_pool.h>
+#include <yarp/BT_wrappers/rpc_deadline.h>
+#include <yarp/BT_wrappers/monitor_publisher.h>
+#include <yarp/BT_wrappers/tick_stats.h>
 
 namespace yarp {
 namespace BT_wrappers {
 
-class TickClient : private yarp::BT_wrappers::BT_request
+class TickClient : private yarp::BT_wrappers::BT_request,
+                   private yarp::os::TypedReaderCallback<yarp::BT_wrappers::ActionStatus>
 {
 public:
     TickClient();
@@ -45,9 +55,51 @@ public:
      *                      externally, usually via yarpmanager
      * @param serverPort    name of the remote port to connect to. A 'tick:i' suffix
      *                      will be appended to <serverPort> param.
-     * @return              true if success, false otherwise
+     * @param subscribeStatus   if true, the client also opens <portPrefix> + "/" + <clientName> + "/status:i"
+     *                      and connects it to the 'status:o' port of a threaded server. While an action is
+     *                      running, ticks are then answered locally with BT_RUNNING and the server is
+     *                      contacted again only once it notifies the action is finished.
+     * @return              true if success, false otherwise. A server not available yet is waited for a few
+     *                      seconds, retrying with an exponential backoff (see RpcDeadline::connect).
      */
-    bool connect(const std::string serverPort);
+    bool connect(const std::string serverPort, bool subscribeStatus = false);
+
+    /**
+     * @brief setTimeout    Max time to wait for the reply of the server to each request, in seconds.
+     *                      A tick whose deadline expires returns BT_FAILURE; after a failure the following
+     *                      requests fail immediately, without waiting, until the server is tried again with
+     *                      an exponential backoff (see RpcDeadline). Zero or negative waits forever (default).
+     *                      To be called before connect, so that no request is sent without the timeout.
+     */
+    bool setTimeout(double seconds);
+
+    /**
+     * @brief registerTarget    Register <target> on the server, so that next ticks, halts and status requests
+     *                          for it send a compact handle instead of the whole ActionID.
+     *                          To be called once, after connect. The target is registered again automatically
+     *                          if the connection to the server is restored after a failure.
+     * @return                  false if the server does not support handles or cannot register more targets;
+     *                          the full ActionID will be sent as before.
+     */
+    bool registerTarget(const yarp::BT_wrappers::ActionID &target);
+
+    /**
+     * @brief needsRemoteTick   Check whether next request_tick for <target> will be sent to the server.
+     * @return                  false if the client is subscribed to the server status and the action is
+     *                          known to be still running, so the tick will be answered locally.
+     */
+    bool needsRemoteTick(const yarp::BT_wrappers::ActionID &target) const;
+
+    /**
+     * @brief setVerbose    Enable debug messages for each tick sent. Disabled by default,
+     *                      since they require to print the params of every tick.
+     */
+    void setVerbose(bool verbose) { _verbose = verbose; }
+
+    /**
+     * @brief getMonitorPublisher   Access the monitor publisher, e.g. to check its published/dropped counters
+     */
+    const MonitorPublisher& getMonitorPublisher() const { return _monitor; }
 
     //Thrift services inherited from BTCmd
     /**
@@ -63,6 +115,41 @@ public:
      */
     ReturnStatus request_tick(  const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params = {}) override;
 
+    /**
+     * @brief request_tick  Same as above, for params whose changes are tracked by the caller, e.g. through the
+     *                      version of the blackboard target they come from.
+     * @param paramsVersion Any number identifying the content of <params>: if the target was registered
+     *                      (see registerTarget) the params are sent to the server only when it changes.
+     *                      Zero means unknown, the params are sent every time.
+     */
+    ReturnStatus request_tick(  const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params, std::int64_t paramsVersion);
+
+    /**
+     * @brief request_tick_async    Same as request_tick, without waiting for the reply of the server.
+     *                      The RPC is performed by a thread owned by this client, so the caller is never blocked
+     *                      by network I/O or by a slow server. Requests are executed in order, one at a time.
+     *                      When the tick can be answered locally (see `needsRemoteTick`) the future is
+     *                      ready on return.
+     * @return              future holding the status of the action on the server side.
+     */
+    std::future<ReturnStatus> request_tick_async(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params = {});
+
+    /**
+     * @brief request_tick_async    Same as above, with the params computed right before sending the tick.
+     * @param getParams     called by the thread performing the RPC, e.g. to fetch the params from the
+     *                      blackboard without blocking the caller. Not called if the tick is answered locally.
+     */
+    std::future<ReturnStatus> request_tick_async(const yarp::BT_wrappers::ActionID &target, std::function<yarp::os::Property()> getParams);
+
+    /**
+     * @brief request_tick_async    Same as above, for params whose changes are tracked, e.g. read with
+     *                      BlackBoardClient::getData(target, version).
+     * @param getParams     also sets <paramsVersion>, see request_tick(target, params, paramsVersion):
+     *                      the params are sent to the server only when their version changes.
+     */
+    std::future<ReturnStatus> request_tick_async(const yarp::BT_wrappers::ActionID &target,
+                                                 std::function<yarp::os::Property(std::int64_t &paramsVersion)> getParams);
+
     /**
      * @brief request_halt  Send a Halt request to the server, along with its parameters.
      *
@@ -78,6 +165,28 @@ public:
      */
     ReturnStatus request_halt(  const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params = {}) override;
 
+    /**
+     * @brief request_halt_async    Same as request_halt, without waiting for the reply of the server.
+     *                      The halt is queued after the asynchronous ticks still pending, so the server receives it
+     *                      after them; meanwhile ticks of <target> are not answered locally.
+     * @param getParams     called by the thread performing the RPC, right before sending the halt.
+     * @return              future holding the status of the action on the server side.
+     */
+    std::future<ReturnStatus> request_halt_async(const yarp::BT_wrappers::ActionID &target, std::function<yarp::os::Property()> getParams);
+
+    /**
+     * @brief request_batch_tick  Send the Tick requests of several actions to the server in a single message.
+     *                      Same as calling request_tick for each target, in order, with a single round trip.
+     *                      Ticks are always sent to the server, even when subscribed to its status.
+     *
+     * @param targets       The actions to tick, all handled by the server this client is connected to.
+     * @param params        The parameters of each action, matched to <targets> by position.
+     * @return              The status of each action, in the same order as <targets>.
+     *                      In case of communication failure, all of them are BT_FAILURE.
+     */
+    std::vector<ReturnStatus> request_batch_tick(const std::vector<yarp::BT_wrappers::ActionID> &targets,
+                                                 const std::vector<yarp::os::Property> &params) override;
+
     /**
      * @brief request_status  Get the status of the action on the server side.
      *
@@ -101,14 +210,89 @@ public:
      */
     bool request_terminate()  override;
 
+    /**
+     * @brief getStats      Statistics collected by this client since start or last reset: counters of ticks,
+     *                      halts and replies for each ReturnStatus, number of ticks answered locally and
+     *                      of ticks sent without params since the server had their version already,
+     *                      round trip time histograms in microseconds and counters of expired deadlines.
+     */
+    yarp::os::Property getStats() const;
+
+    /**
+     * @brief resetStats    Clear the statistics collected by this client.
+     */
+    void resetStats();
+
+    // Statistics of the remote server, see TickServer::request_stats
+    using BT_request::request_stats;
+    using BT_request::reset_stats;
+
 private:
     std::string _portPrefix;
     std::string _clientName;
     std::string _serverName;
     yarp::os::Port _requestPort;
-    yarp::os::Port _toMonitor_port;
+    RpcDeadline    _deadline;
+    MonitorPublisher _monitor;
 
     std::atomic<yarp::BT_wrappers::ReturnStatus> status_;
+    std::atomic<bool> _verbose {false};
+
+    /* Status of each action as known by this client, used when subscribed to the server status.
+     * Written by the thread sending the RPCs (possibly the asynchronous one) and by the status port
+     * callback, read by the thread calling request_tick_async: every field is atomic.
+     * A completion message is only a wake-up hint, its status is not used: the server acknowledges
+     * the completion of an action (and makes it idle again) when it replies to the next tick, so that
+     * tick has to be sent anyway.
+     */
+    struct CachedStatus {
+        std::atomic<yarp::BT_wrappers::ReturnStatus> status {BT_IDLE};   // reply to last tick or halt RPC
+        std::atomic<std::int64_t> notifications {0};            // completion messages received
+        std::atomic<std::int64_t> notifications_at_tick {0};    // value of notifications before last tick RPC
+        std::atomic<double>       last_tick_time {0.0};
+        std::atomic<int>          pending_halts {0};            // halts queued by request_halt_async and not sent yet
+    };
+
+    bool _subscribed {false};
+    yarp::os::BufferedPort<yarp::BT_wrappers::ActionStatus> _statusPort;
+    ActionTable<CachedStatus> _statusCache;
+
+    void onRead(yarp::BT_wrappers::ActionStatus& msg) override;
+
+    // Handles of the targets registered on the server
+    struct TargetHandle {
+        std::int32_t                handle {0};
+        std::uint64_t               epoch {0};      // _deadline.reconnections() at registration
+        yarp::BT_wrappers::ActionID target;
+        bool                        acked {false};  // the server stores the params of version <acked_version>
+        std::int64_t                acked_version {0};
+    };
+    std::mutex                  _handlesMutex;
+    ActionTable<TargetHandle>   _handles;
+
+    // handle to be used for <target>, 0 to send the full ActionID
+    std::int32_t handleOf(const yarp::BT_wrappers::ActionID &target);
+
+    // tick through <handle>, sending <params> only if the server does not have their <version> already
+    yarp::BT_wrappers::ReturnStatus tickVersioned(std::int32_t handle, const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params, std::int64_t version);
+
+    // thread sending the asynchronous requests, started at first use
+    std::mutex  _asyncMutex;
+    WorkerPool  _asyncWorker;
+
+    // tick answered from the cached status, and tick sent to the server
+    yarp::BT_wrappers::ReturnStatus localTick();
+    yarp::BT_wrappers::ReturnStatus remoteTick(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params, std::int64_t paramsVersion);
+
+    // run <request> in the asynchronous thread, false if it was not queued and <result> holds BT_ERROR
+    bool runAsync(std::function<yarp::BT_wrappers::ReturnStatus(bool discarded)> request, std::future<yarp::BT_wrappers::ReturnStatus> &result);
+
+    // statistics
+    TickCounters                _counters;
+    std::atomic<std::uint64_t>  _localTicks {0};
+    std::atomic<std::uint64_t>  _paramsSkipped {0};
+    LatencyHistogram            _rttLatency;
+    LatencyHistogram            _haltLatency;
 };
 
 }}
@@ -12,25 +12,18 @@
  */
 
 #include "tick_server.h"
+#include "action_table.h"
 
 #include <thread>
 #include <iostream>
 #include <future>
+#include <memory>
 
 #include <yarp/os/LogStream.h>
-#include <yarp/os/PortablePair.h>
-#include <yarp/BT_wrappers/MonitorMsg.h>
 
 using namespace yarp::os;
 using namespace yarp::BT_wrappers;
 
-struct CompareActionID
-{
-    bool operator()(const ActionID& lhs, const ActionID& rhs) const {
-        return lhs.action_ID < rhs.action_ID;
-    }
-};
-
 class TickServer::RequestHandler: public BT_request
 {
 private:
@@ -38,23 +31,44 @@ private:
 
     // Helper struct for easy remapping of calls and data
     struct ActionData {
-        ReturnStatus    status;
-        std::atomic<bool> is_halt_requested;
+        std::atomic<ReturnStatus> status;
+        CancellationSource      halt_request;       // wakes up user code waiting on a CancellationToken
         std::future<ReturnStatus> future_res;
         std::mutex              _cv_mutex;
         std::condition_variable _cv_wait_for_thread;
+        std::atomic<bool>       thread_finished;    // written holding _cv_mutex
+        bool                    active;             // between onActionStarted and onActionFinished, guarded by _cv_mutex
+
+        // last params received with tick_versioned
+        std::mutex              params_mutex;
+        bool                    has_params;
+        std::int64_t            params_version;
+        yarp::os::Property      params;
 
-        ActionData() : status(BT_IDLE), is_halt_requested(false) {}
+        ActionData() : status(BT_IDLE), thread_finished(true), active(false), has_params(false), params_version(0) {}
     };
 
-    std::map<ActionID, ActionData, CompareActionID> _targetMap;
+    ActionTable<ActionData> _targetTable;
+
+    // ActionIDs registered by clients, the handle is the position in the table plus one.
+    // Entries are written once, before _numHandles is incremented, so lookups need no lock
+    std::unique_ptr<ActionID[]> _handles;
+    std::atomic<std::int32_t>   _numHandles {0};
+    std::mutex                  _handlesMutex;
+
+    // ActionID registered with <handle>, nullptr if unknown
+    const ActionID *findHandle(std::int32_t handle) const;
 
 public:
 
     RequestHandler(TickServer * owner);
 
-    // get Data associated to requested target; for TickServer internal use only
-    ActionData &getData(ActionID target);
+    // get Data associated to requested target, nullptr if the target was never ticked;
+    // for TickServer internal use only
+    ActionData *findData(const ActionID &target) const;
+
+    // request the halt of all the actions, user code waiting on a CancellationToken returns
+    void cancelAll();
 
     bool request_initialize() override;
 
@@ -64,18 +78,68 @@ public:
 
     ReturnStatus request_halt(const ActionID& target, const yarp::os::Property& params) override;
 
+    std::vector<ReturnStatus> request_batch_tick(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params) override;
+
+    std::int32_t register_target(const ActionID& target) override;
+
+    ReturnStatus tick_handle(const std::int32_t handle, const yarp::os::Property& params) override;
+
+    TickReply tick_versioned(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params) override;
+
+    ReturnStatus halt_handle(const std::int32_t handle, const yarp::os::Property& params) override;
+
+    ReturnStatus status_handle(const std::int32_t handle) override;
+
     ReturnStatus request_status(const ActionID& target) override;
 
+    yarp::os::Property request_stats() override;
+
+    bool reset_stats() override;
+
+private:
+    // request_tick and request_halt without the collection of statistics
+    ReturnStatus handle_tick(const ActionID& target, const yarp::os::Property& params);
+
+    ReturnStatus handle_halt(const ActionID& target, const yarp::os::Property& params);
+
+    // lifecycle notifications to the owner, to be called holding _cv_mutex of the action
+    void startAction(const ActionID& target, ActionData &targetData);
+
+    void finishAction(const ActionID& target, ActionData &targetData, ReturnStatus status);
 };
 
-TickServer::RequestHandler::RequestHandler(TickServer *owner) :  _owner(owner)
+constexpr size_t TickServer::MAX_ACTIONS;
+
+TickServer::RequestHandler::RequestHandler(TickServer *owner) :  _owner(owner), _targetTable(MAX_ACTIONS),
+                                                                  _handles(new ActionID[MAX_ACTIONS])
 {
 
 }
 
-TickServer::RequestHandler::ActionData &TickServer::RequestHandler::getData(ActionID target)
+TickServer::RequestHandler::ActionData *TickServer::RequestHandler::findData(const ActionID &target) const
+{
+    return _targetTable.find(target.action_ID);
+}
+
+void TickServer::RequestHandler::cancelAll()
+{
+    _targetTable.forEach([](std::int32_t, ActionData &targetData) { targetData.halt_request.cancel(); });
+}
+
+void TickServer::RequestHandler::startAction(const ActionID& target, ActionData &targetData)
 {
-    return _targetMap[target];
+    if(targetData.active)
+        return;
+    targetData.active = true;
+    _owner->onActionStarted(target);
+}
+
+void TickServer::RequestHandler::finishAction(const ActionID& target, ActionData &targetData, ReturnStatus status)
+{
+    if(!targetData.active)
+        return;
+    targetData.active = false;
+    _owner->onActionFinished(target, status);
 }
 
 bool TickServer::RequestHandler:: request_initialize()
@@ -90,33 +154,60 @@ bool TickServer::RequestHandler::request_terminate()
 
 ReturnStatus TickServer::RequestHandler::request_tick(const ActionID& target, const yarp::os::Property& params)
 {
-    // Place here a message for monitoring: we received a tick msg
-    {   // additional scope, to cleanup the variables afterward
-        yarp::os::PortablePair<yarp::BT_wrappers::MonitorMsg, Bottle> monitor;
-        MonitorMsg &msg = monitor.head;
-        msg = monitor.head;
-        msg.skill     = _owner->_serverName;
-        msg.event     = "e_req";
-        _owner->_toMonitor_port.write(monitor);
-    }
+    // histogram and counters are relaxed atomic increments, cheap enough for the reader thread of the tick port
+    auto start = std::chrono::steady_clock::now();
+    ReturnStatus ret = handle_tick(target, params);
+    _owner->_tickLatency.record(std::chrono::steady_clock::now() - start);
+    _owner->_counters.countTick();
+    _owner->_counters.countReply(ret);
+    return ret;
+}
 
+ReturnStatus TickServer::RequestHandler::handle_tick(const ActionID& target, const yarp::os::Property& params)
+{
     // Get ActionData corresponding to requested ActionID;
-    // if ActionID is new, create the entry in the map
-    ActionData &targetData =  _targetMap[target];
-    ReturnStatus return_status = targetData.status;
-    ReturnStatusVocab statusString;
+    // if ActionID is new, reserve an entry in the table
+    ActionData *targetSlot = _targetTable.findOrInsert(target.action_ID);
+    if(!targetSlot)
+    {
+        _owner->_monitor.publish("e_req");
+        yError("TickServer::RequestHandler::request_tick: server %s cannot handle more than %zu actions",
+               _owner->_serverName.c_str(), _targetTable.capacity());
+        return BT_ERROR;
+    }
+    ActionData &targetData = *targetSlot;
+    ReturnStatus return_status = targetData.status.load(std::memory_order_acquire);
+
+    /* Fast path: the action is running in a worker thread that did not finish yet,
+     * answer from the atomic status without taking locks or touching the params.
+     * Monitor events are only posted to the ring: waking the publishing thread up takes a mutex.
+     */
+    if(return_status == BT_RUNNING && !targetData.thread_finished.load(std::memory_order_acquire))
+    {
+        _owner->_monitor.post("e_req");
+        _owner->_monitor.post("e_from_env");
+        return BT_RUNNING;
+    }
+
+    // Place here a message for monitoring: we received a tick msg
+    _owner->_monitor.publish("e_req");
 
     // for synch between tick and halt
     std::unique_lock<std::mutex> lk(targetData._cv_mutex);
 
-    yDebug() << "TickServer::RequestHandler::request_tick(action " << target.target << \
-                " params " << params.toString() << ") threaded is " << _owner->_threaded << " status is " << statusString.toString(return_status);
+    if(_owner->_verbose)
+    {
+        ReturnStatusVocab statusString;
+        yDebug() << "TickServer::RequestHandler::request_tick(action " << target.target << \
+                    " params " << params.toString() << ") threaded is " << _owner->_threaded << " status is " << statusString.toString(return_status);
+    }
 
     switch (return_status)
     {
         case BT_ERROR:
         {
             yError("TickServer::RequestHandler::request_tick: The BT node %s returned error", _owner->_serverName.c_str());
+            finishAction(target, targetData, return_status);
         } break;
 
         case BT_RUNNING:
@@ -132,7 +223,7 @@ ReturnStatus TickServer::RequestHandler::request_tick(const ActionID& target, co
                 if(targetData.status == BT_RUNNING)
                 {
                     yError() << "request_tick shall not return BT_RUNNING.";
-                    targetData.status == BT_ERROR;
+                    targetData.status = BT_ERROR;
                 }
                 return_status   = targetData.status;
             }
@@ -146,6 +237,7 @@ ReturnStatus TickServer::RequestHandler::request_tick(const ActionID& target, co
              * Then the server state will be set to IDLE, so that next tick the routine
              * will start again as expected.
              */
+            finishAction(target, targetData, return_status);
             targetData.status = BT_IDLE;
         }
         break;
@@ -154,27 +246,71 @@ ReturnStatus TickServer::RequestHandler::request_tick(const ActionID& target, co
         case BT_HALTED:
         {
             /* In case the routine is not running, then let's start it */
+            startAction(target, targetData);
             if(_owner->_threaded)
             {
-                yDebug() << "Spawning thread";
-                _owner->_thread_finished = false;
-                targetData.future_res = std::async([this, &target, &params, &targetData]
-                                                    {                    
-                                                        ReturnStatus ret = _owner->request_tick(target, params);
-                                                        // wake up condition variable
-                                                        _owner->_thread_finished = true;
-                                                        targetData._cv_wait_for_thread.notify_one();
-                                                        return ret;
-                                                    });
-                targetData.status = BT_RUNNING;
-                return_status   = targetData.status;
+                /* Hand the user's routine over to the worker pool. Target and params are
+                 * copied into the job because the RPC arguments go out of scope as soon
+                 * as this tick returns.
+                 * The job is run with <discarded> set if the pool is stopped before it
+                 * starts: user code is skipped, the action is marked as finished anyway.
+                 */
+                auto queued = std::chrono::steady_clock::now();
+                auto job = std::make_shared<std::packaged_task<ReturnStatus(bool)>>(
+                                [this, target, params, &targetData, queued](bool discarded)
+                                {
+                                    auto start = std::chrono::steady_clock::now();
+                                    if(!discarded)
+                                        _owner->_queueLatency.record(start - queued);
+
+                                    ReturnStatus ret = BT_HALTED;
+                                    // A halt may arrive while the job is still waiting in the queue
+                                    if(!discarded && !targetData.halt_request.isCancelled())
+                                    {
+                                        ret = _owner->request_tick(target, params);
+                                        _owner->_userLatency.record(std::chrono::steady_clock::now() - start);
+                                    }
+                                    _owner->publishStatus(target.action_ID, ret);
+                                    // wake up condition variable, only a halt of this very action is waiting on it
+                                    {
+                                        std::lock_guard<std::mutex> cv_lock(targetData._cv_mutex);
+                                        targetData.thread_finished = true;
+                                    }
+                                    targetData._cv_wait_for_thread.notify_all();
+                                    return ret;
+                                });
+
+                // tick holds _cv_mutex already
+                targetData.thread_finished = false;
+                targetData.future_res = job->get_future();
+                if(_owner->_workerPool.submit([job]{ (*job)(false); }, [job]{ (*job)(true); }))
+                {
+                    targetData.status = BT_RUNNING;
+                    return_status   = targetData.status;
+                }
+                else
+                {
+                    yWarning("TickServer::RequestHandler::request_tick: server %s is saturated, action %s rejected",
+                             _owner->_serverName.c_str(), target.target.c_str());
+                    targetData.thread_finished = true;
+                    targetData.future_res = {};
+                    _owner->_counters.countRejected();
+                    return_status = BT_FAILURE;
+                    finishAction(target, targetData, return_status);
+                }
             }
             else
             {
                 /* In case user's routine is quick and does not require a separated thread,
                  * then the server will simply run it and returns the user's return value
                  */
+                auto start = std::chrono::steady_clock::now();
                 return_status = _owner->request_tick(target, params);
+                _owner->_userLatency.record(std::chrono::steady_clock::now() - start);
+
+                // a quick routine may return RUNNING and keep its state until next tick
+                if(return_status != BT_RUNNING)
+                    finishAction(target, targetData, return_status);
             }
         } break;
 
@@ -188,27 +324,135 @@ ReturnStatus TickServer::RequestHandler::request_tick(const ActionID& target, co
     }
 
     // send message to monitor: we are done with it
-    {   // additional scope, to cleanup the variables afterward
-        yarp::os::PortablePair<yarp::BT_wrappers::MonitorMsg, Bottle> monitor;
-        MonitorMsg &msg = monitor.head;
-        msg = monitor.head;
-        msg.skill     = _owner->_serverName;
-        msg.event     = "e_from_env";
-        _owner->_toMonitor_port.write(monitor);
-    }
+    _owner->_monitor.publish("e_from_env");
     return return_status;
 }
 
+std::vector<ReturnStatus> TickServer::RequestHandler::request_batch_tick(const std::vector<ActionID>& targets, const std::vector<yarp::os::Property>& params)
+{
+    static const yarp::os::Property noParams;
+
+    std::vector<ReturnStatus> ret;
+    ret.reserve(targets.size());
+    for(size_t i=0; i<targets.size(); i++)
+        ret.push_back(request_tick(targets[i], i < params.size() ? params[i] : noParams));
+    return ret;
+}
+
+const ActionID *TickServer::RequestHandler::findHandle(std::int32_t handle) const
+{
+    if(handle <= 0 || handle > _numHandles.load(std::memory_order_acquire))
+        return nullptr;
+    return &_handles[handle - 1];
+}
+
+std::int32_t TickServer::RequestHandler::register_target(const ActionID& target)
+{
+    std::lock_guard<std::mutex> lock(_handlesMutex);
+
+    std::int32_t count = _numHandles.load(std::memory_order_relaxed);
+    for(std::int32_t i=0; i<count; i++)
+    {
+        const ActionID &known = _handles[i];
+        if(known.action_ID == target.action_ID && known.target == target.target && known.resources == target.resources)
+            return i + 1;
+    }
+
+    if(count >= static_cast<std::int32_t>(MAX_ACTIONS))
+    {
+        yWarning("TickServer::RequestHandler::register_target: server %s cannot register more than %zu targets",
+                 _owner->_serverName.c_str(), MAX_ACTIONS);
+        return 0;
+    }
+
+    _handles[count] = target;
+    _numHandles.store(count + 1, std::memory_order_release);
+    return count + 1;
+}
+
+ReturnStatus TickServer::RequestHandler::tick_handle(const std::int32_t handle, const yarp::os::Property& params)
+{
+    const ActionID *target = findHandle(handle);
+    if(!target)
+    {
+        yError("TickServer::RequestHandler::tick_handle: server %s received unknown handle %d", _owner->_serverName.c_str(), handle);
+        return BT_ERROR;
+    }
+    return request_tick(*target, params);
+}
+
+TickReply TickServer::RequestHandler::tick_versioned(const std::int32_t handle, const std::int64_t version, const bool with_params, const yarp::os::Property& params)
+{
+    TickReply reply;
+    reply.params_needed = false;
+
+    const ActionID *target = findHandle(handle);
+    ActionData *targetData = target ? _targetTable.findOrInsert(target->action_ID) : nullptr;
+    if(!targetData)
+    {
+        yError("TickServer::RequestHandler::tick_versioned: server %s received unknown handle %d", _owner->_serverName.c_str(), handle);
+        reply.status = BT_ERROR;
+        return reply;
+    }
+
+    // The stored params are used in place, they cannot change until the tick is over
+    std::lock_guard<std::mutex> lock(targetData->params_mutex);
+    if(with_params)
+    {
+        targetData->params         = params;
+        targetData->params_version = version;
+        targetData->has_params     = true;
+    }
+    else if(!targetData->has_params || targetData->params_version != version)
+    {
+        reply.status        = BT_IDLE;
+        reply.params_needed = true;
+        return reply;
+    }
+
+    reply.status = request_tick(*target, targetData->params);
+    return reply;
+}
+
+ReturnStatus TickServer::RequestHandler::halt_handle(const std::int32_t handle, const yarp::os::Property& params)
+{
+    const ActionID *target = findHandle(handle);
+    if(!target)
+    {
+        yError("TickServer::RequestHandler::halt_handle: server %s received unknown handle %d", _owner->_serverName.c_str(), handle);
+        return BT_ERROR;
+    }
+    return request_halt(*target, params);
+}
+
+ReturnStatus TickServer::RequestHandler::status_handle(const std::int32_t handle)
+{
+    const ActionID *target = findHandle(handle);
+    return target ? request_status(*target) : BT_ERROR;
+}
+
 ReturnStatus TickServer::RequestHandler::request_halt(const ActionID& target, const yarp::os::Property& params)
+{
+    auto start = std::chrono::steady_clock::now();
+    ReturnStatus ret = handle_halt(target, params);
+    _owner->_haltLatency.record(std::chrono::steady_clock::now() - start);
+    _owner->_counters.countHalt();
+    return ret;
+}
+
+ReturnStatus TickServer::RequestHandler::handle_halt(const ActionID& target, const yarp::os::Property& params)
 {
     // Get ActionData corresponding to requested ActionID;
-    // if ActionID is new, create the entry in the map
-    ActionData &targetData =  _targetMap[target];
+    // an action never ticked is idle, there is nothing to halt
+    ActionData *targetSlot = findData(target);
+    if(!targetSlot)
+        return BT_IDLE;
+    ActionData &targetData = *targetSlot;
     ReturnStatus return_status = targetData.status;
 
-    // TODO: check with Michele
-    // Set is_halt_requested
-    targetData.is_halt_requested = true;
+    // Raise the halt request before calling the user's halt: user code of this action waiting on its token
+    // returns at once. The request is reset once the halt is over, so the next tick starts with a clean token.
+    targetData.halt_request.cancel();
 
     switch (return_status)
     {
@@ -226,18 +470,26 @@ ReturnStatus TickServer::RequestHandler::request_halt(const ActionID& target, co
             return_status = _owner->request_halt(target, params);
             if(_owner->_threaded)
             {
-                // wait until the running thread has finished
+                // wait until the thread running this action has finished, other actions keep running
                 std::unique_lock<std::mutex> cv_lock(targetData._cv_mutex);
-                targetData._cv_wait_for_thread.wait(cv_lock, [this]{return this->_owner->_thread_finished;});
+                targetData._cv_wait_for_thread.wait(cv_lock, [&targetData]{return targetData.thread_finished.load();});
+
+                // the action is over: discard its result so that next tick starts it again
+                if(targetData.future_res.valid())
+                    targetData.future_res.get();
+                targetData.status = return_status;
+                finishAction(target, targetData, return_status);
                 cv_lock.unlock();
-                yInfo() << "thread finished";
+                yDebug() << "TickServer::RequestHandler::request_halt: thread for action" << target.action_ID << "finished";
             }
         } break;
 
         case BT_IDLE:
         case BT_HALTED:
         {
-            // nothing to do
+            // nothing to do, except for a non threaded action halted after returning RUNNING
+            std::lock_guard<std::mutex> cv_lock(targetData._cv_mutex);
+            finishAction(target, targetData, BT_HALTED);
         } break;
 
         default:
@@ -248,18 +500,24 @@ ReturnStatus TickServer::RequestHandler::request_halt(const ActionID& target, co
         } break;
     }
 
-
-    // Unset is_halt_requested ???
-    // targetData.is_halt_requested = false;
-
-    targetData.is_halt_requested = false;
+    targetData.halt_request.reset();
 
     return return_status;
 }
 
 ReturnStatus TickServer::RequestHandler::request_status(const ActionID& target)
 {
-    return _targetMap[target].status;
+    ActionData *targetData = findData(target);
+    return targetData ? targetData->status.load() : BT_IDLE;
+}
+yarp::os::Property TickServer::RequestHandler::request_stats()
+{
+    return _owner->request_stats();
+}
+
+bool TickServer::RequestHandler::reset_stats()
+{
+    return _owner->reset_stats();
 }
 //
 // END of RequestHandler class
@@ -271,20 +529,64 @@ TickServer::TickServer() :  _requestHandler(std::make_unique<RequestHandler>(thi
 
 TickServer::~TickServer()
 {
+    close_TickServer();
+}
+
+void TickServer::close_TickServer()
+{
+    // no more ticks
     _requestPort.interrupt();
     _requestPort.close();
 
-    _toMonitor_port.interrupt();
-    _toMonitor_port.close();
+    // user code checking its token returns, then the workers are joined
+    _requestHandler->cancelAll();
+    _workerPool.stop();
+
+    _monitor.close();
+
+    _status_port.interrupt();
+    _status_port.close();
 }
 
 bool TickServer::isHaltRequested(const yarp::BT_wrappers::ActionID target)
 {
-    return _requestHandler->getData(target).is_halt_requested;
+    auto targetData = _requestHandler->findData(target);
+    return targetData && targetData->halt_request.isCancelled();
+}
+
+CancellationToken TickServer::getCancellationToken(const yarp::BT_wrappers::ActionID &target)
+{
+    auto targetData = _requestHandler->findData(target);
+    return targetData ? CancellationToken(&targetData->halt_request) : CancellationToken();
 }
 
 
-bool TickServer::configure_TickServer(std::string portPrefix, std::string serverName, bool threaded)
+size_t TickServer::getPoolSize() const
+{
+    return _workerPool.poolSize();
+}
+
+size_t TickServer::getQueueDepth() const
+{
+    return _workerPool.queueDepth();
+}
+
+void TickServer::publishStatus(std::int32_t action_ID, ReturnStatus status)
+{
+    if(_status_port.getOutputCount() == 0)
+        return;
+
+    // called by worker threads, BufferedPort::prepare/write are not reentrant
+    std::lock_guard<std::mutex> lock(_status_mutex);
+    ActionStatus &msg = _status_port.prepare();
+    msg.action_ID = action_ID;
+    msg.status    = status;
+    msg.seq       = _status_seq++;
+    _status_port.write();
+}
+
+bool TickServer::configure_TickServer(std::string portPrefix, std::string serverName, bool threaded,
+                                      size_t poolSize, size_t queueSize, bool rejectWhenSaturated)
 {
     _portPrefix = portPrefix;
     _serverName = serverName;
@@ -302,12 +604,24 @@ bool TickServer::configure_TickServer(std::string portPrefix, std::string server
         return false;
     }
 
-    if(!_toMonitor_port.open(portPrefix + "/" + serverName +"/monitor:o") )
+    if(!_monitor.open(portPrefix + "/" + serverName +"/monitor:o", _serverName) )
     {
         yError() << _serverName << ": Unable to open monitoring port " << (portPrefix + "/" + serverName +"/monitor:o");
         return false;
     }
 
+    if(_threaded && !_workerPool.start(poolSize, queueSize, rejectWhenSaturated))
+    {
+        yError() << _serverName << ": Unable to start worker pool with " << poolSize << " threads";
+        return false;
+    }
+
+    if(_threaded && !_status_port.open(portPrefix + "/" + serverName +"/status:o") )
+    {
+        yError() << _serverName << ": Unable to open status port " << (portPrefix + "/" + serverName +"/status:o");
+        return false;
+    }
+
     _requestHandler->yarp().attachAsServer(_requestPort);
     return true;
 }
@@ -316,3 +630,35 @@ ReturnStatus TickServer::request_status(const yarp::BT_wrappers::ActionID &targe
 {
     return _requestHandler->request_status(target);
 }
+
+std::vector<ReturnStatus> TickServer::request_batch_tick(const std::vector<ActionID> &targets, const std::vector<Property> &params)
+{
+    return _requestHandler->request_batch_tick(targets, params);
+}
+
+yarp::os::Property TickServer::request_stats()
+{
+    Property stats;
+    _counters.toProperty(stats);
+    _tickLatency.toProperty(stats.addGroup("tick_us"));
+    _userLatency.toProperty(stats.addGroup("user_tick_us"));
+    _queueLatency.toProperty(stats.addGroup("queue_wait_us"));
+    _haltLatency.toProperty(stats.addGroup("halt_us"));
+
+    stats.put("pool_size",          Value::makeInt64(getPoolSize()));
+    stats.put("queue_depth",        Value::makeInt64(getQueueDepth()));
+    stats.put("monitor_published",  Value::makeInt64(_monitor.published()));
+    stats.put("monitor_batches",    Value::makeInt64(_monitor.batches()));
+    stats.put("monitor_dropped",    Value::makeInt64(_monitor.dropped()));
+    return stats;
+}
+
+bool TickServer::reset_stats()
+{
+    _counters.reset();
+    _tickLatency.reset();
+    _userLatency.reset();
+    _queueLatency.reset();
+    _haltLatency.reset();
+    return true;
+}
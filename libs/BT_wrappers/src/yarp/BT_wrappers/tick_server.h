@@ -13,15 +13,27 @@
 #ifndef YARP_bt_modulesS_TICK_SERVER_H
 #define YARP_bt_modulesS_TICK_SERVER_H
 
+#include <new>
+#include <string>
+#include <stdexcept>
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <utility>
+#include <type_traits>
 #include <condition_variable>
 
 #include <yarp/os/Port.h>
+#include <yarp/os/BufferedPort.h>
 #include <yarp/os/RFModule.h>
 #include <yarp/os/LogStream.h>
 #include <yarp/BT_wrappers/BT_request.h>
+#include <yarp/BT_wrappers/ActionStatus.h>
+#include <yarp/BT_wrappers/worker_pool.h>
+#include <yarp/BT_wrappers/action_table.h>
+#include <yarp/BT_wrappers/cancellation_token.h>
+#include <yarp/BT_wrappers/tick_stats.h>
+#include <yarp/BT_wrappers/monitor_publisher.h>
 
 namespace yarp {
 namespace BT_wrappers {
@@ -29,6 +41,9 @@ namespace BT_wrappers {
 class TickServer :  public yarp::BT_wrappers::BT_request
 {
 public:
+    // max number of different action_IDs a single server can handle
+    static constexpr size_t MAX_ACTIONS = 256;
+
     TickServer();
     ~TickServer();
 
@@ -41,10 +56,28 @@ public:
      * @param threaded      If true the execute_tick function will be called in a separated thread.
      *                      Use this option only if you know the tick function contains blocking calls
      *                      or its execution time is grather then behaviour tree period.
+     *                      A threaded server also opens <portPrefix> + "/" + <serverName> + "/status:o"
+     *                      where the result of each action is published as soon as it finishes.
+     * @param poolSize      Threaded mode only: number of worker threads executing request_tick.
+     *                      It bounds how many actions can run in parallel on this server.
+     * @param queueSize     Threaded mode only: max number of started actions waiting for a free worker.
+     * @param rejectWhenSaturated   Threaded mode only: if true, a tick starting a new action while all
+     *                      workers are busy and the queue is full returns BT_FAILURE; if false the
+     *                      tick blocks until a slot is available.
      * @return              true if configuration was successful, false otherwise
      */
     //
-    bool configure_TickServer(std::string portPrefix, std::string serverName, bool threaded=false);
+    bool configure_TickServer(std::string portPrefix, std::string serverName, bool threaded=false,
+                              size_t poolSize=4, size_t queueSize=16, bool rejectWhenSaturated=false);
+
+    /**
+     * @brief close_TickServer  Stop serving: close the tick port, request the halt of every action and wait
+     *                      for the worker threads to finish. Actions still waiting for a worker are not started.
+     *                      Workers call the `request_tick` of the derived class, so a threaded server must call
+     *                      this before anything used by its `request_tick` is destroyed, e.g. first thing in
+     *                      its `close()` or destructor. ~TickServer calls it again, it does nothing the second time.
+     */
+    void close_TickServer();
 
     /**
      * @brief request_tick  Implement this method with user code. It'll run when the server receives the
@@ -95,47 +128,232 @@ public:
      */
     virtual ReturnStatus request_halt(const yarp::BT_wrappers::ActionID &target, const yarp::os::Property &params = {}) override = 0 ;
 
+    /**
+     * @brief request_batch_tick    Handle the ticks of several actions received in a single message.
+     *                              Each one is processed like a separated tick, in order, so user code
+     *                              only needs to implement `request_tick`.
+     * @return                      The status of each action, in the same order as <targets>.
+     */
+    std::vector<ReturnStatus> request_batch_tick(const std::vector<yarp::BT_wrappers::ActionID> &targets,
+                                                 const std::vector<yarp::os::Property> &params) override;
+
     virtual bool request_initialize() override { return true; }
 
     virtual bool request_terminate()  override { return true; }
 
+    /**
+     * @brief request_stats     Statistics collected since start or last reset: counters of ticks, halts and
+     *                          replies given for each ReturnStatus, and latency histograms in microseconds of
+     *                          tick handling, user's request_tick code, wait in the worker pool queue and halts.
+     *                          Also available remotely through the tick port.
+     */
+    yarp::os::Property request_stats() override;
+
+    /**
+     * @brief reset_stats       Clear all the statistics.
+     */
+    bool reset_stats() override;
+
     /**
      * @brief isHaltRequested       Returns if a Halt has been requested on target
      * @return                      true if halt was requested, false otherwise
      */
     bool isHaltRequested(const yarp::BT_wrappers::ActionID target);
 
+    /**
+     * @brief getCancellationToken  Returns a token tracking halt requests on target. Unlike polling
+     *                              `isHaltRequested`, its wait functions return as soon as the halt arrives.
+     *                              To be called inside `request_tick`, the token stays valid for the whole
+     *                              life of the server.
+     * @return                      the token associated to target, or a token never cancelled in case
+     *                              target was never ticked
+     */
+    CancellationToken getCancellationToken(const yarp::BT_wrappers::ActionID &target);
+
+    /**
+     * @brief setVerbose            Enable debug messages for each tick received. Disabled by default,
+     *                              since they require to print the params of every tick.
+     */
+    void setVerbose(bool verbose) { _verbose = verbose; }
+
+    /**
+     * @brief getPoolSize           Number of worker threads, 0 if the server is not threaded
+     */
+    size_t getPoolSize() const;
+
+    /**
+     * @brief getQueueDepth         Number of started actions currently waiting for a free worker
+     */
+    size_t getQueueDepth() const;
+
+    /**
+     * @brief getMonitorPublisher   Access the monitor publisher, e.g. to check its published/dropped counters
+     */
+    const MonitorPublisher& getMonitorPublisher() const { return _monitor; }
+
+protected:
+    /**
+     * @brief onActionStarted   Called right before the user's `request_tick` starts a new execution of the
+     *                          action, i.e. on the tick moving it out of IDLE or HALTED. In threaded mode
+     *                          it runs in the tick thread, before the action is handed to a worker.
+     */
+    virtual void onActionStarted(const yarp::BT_wrappers::ActionID &target) {}
+
+    /**
+     * @brief onActionFinished  Called once the execution of the action is over and its result has been
+     *                          delivered: when SUCCESS/FAILURE is acknowledged to the Behaviour Tree, or when
+     *                          a running action has been halted. The user's code of the action is not running.
+     * @param status            the final status of the action
+     */
+    virtual void onActionFinished(const yarp::BT_wrappers::ActionID &target, ReturnStatus status) {}
+
 private:
     std::string     _portPrefix;
     std::string     _serverName;
     bool            _threaded {false};
-    bool            _thread_finished{true};
+    std::atomic<bool> _verbose {false};
+
+    WorkerPool      _workerPool;
 
     yarp::os::Port  _requestPort;
-    yarp::os::Port  _toMonitor_port;
+    MonitorPublisher _monitor;
+
+    // completion notifications for subscribed clients
+    yarp::os::BufferedPort<ActionStatus>    _status_port;
+    std::mutex                              _status_mutex;
+    std::int64_t                            _status_seq {0};
+    void publishStatus(std::int32_t action_ID, ReturnStatus status);
+
+    // statistics
+    TickCounters        _counters;
+    LatencyHistogram    _tickLatency;
+    LatencyHistogram    _userLatency;
+    LatencyHistogram    _queueLatency;
+    LatencyHistogram    _haltLatency;
 
     class RequestHandler;
     std::unique_ptr<RequestHandler> _requestHandler;
 };
 
+/**
+ * @brief The TickServer_withData class     TickServer keeping an instance of T for each running action.
+ *
+ * The instance is constructed in place when the action starts, value-initialized, and destroyed when the
+ * action finishes, so every execution of the action starts from a clean state. Storage for all the
+ * actions is allocated once, together with the server: ticking never allocates.
+ * `getData` and `setData` are meant to be used inside `request_tick` and `request_halt`.
+ * Derived classes overriding `onActionStarted` or `onActionFinished` must call the versions defined here.
+ */
 template <typename T>
 class TickServer_withData :  public TickServer
 {
-private:
-    std::map<ActionID, T> userData;
-
 public:
+    ~TickServer_withData()
+    {
+        // no worker may use the data of an action from now on
+        close_TickServer();
+        _userData.forEach([](std::int32_t, Slot &slot) { slot.destroy(); });
+    }
+
+    /**
+     * @brief getData   Data of the action <id>; value-initialized if the action has none yet.
+     * @throw std::length_error if <id> is new and the data of MAX_ACTIONS different actions is
+     *        already stored
+     */
+    T& getData(const yarp::BT_wrappers::ActionID &id)
+    {
+        Slot *slot = slotOf(id);
+        if(!slot->constructed)
+            slot->construct();
+        return *slot->get();
+    }
+
+    /**
+     * @brief findData  Data of the action <id>, nullptr if the action is not running.
+     */
+    T* findData(const yarp::BT_wrappers::ActionID &id) const
+    {
+        Slot *slot = _userData.find(id.action_ID);
+        return (slot && slot->constructed) ? slot->get() : nullptr;
+    }
+
+    void setData(const yarp::BT_wrappers::ActionID &id, const T &data)
+    {
+        getData(id) = data;
+    }
+
+    void setData(const yarp::BT_wrappers::ActionID &id, T &&data)
+    {
+        getData(id) = std::move(data);
+    }
+
+    /**
+     * @brief emplaceData   Replace the data of the action <id> with an instance built from <args>.
+     * @throw std::length_error as getData
+     */
+    template <typename... Args>
+    T& emplaceData(const yarp::BT_wrappers::ActionID &id, Args&&... args)
+    {
+        Slot *slot = slotOf(id);
+        slot->destroy();
+        slot->construct(std::forward<Args>(args)...);
+        return *slot->get();
+    }
 
-    T& getData(ActionID id)
+protected:
+    void onActionStarted(const yarp::BT_wrappers::ActionID &target) override
     {
-        return userData[id];
+        // called while answering a tick: report a full table instead of throwing
+        Slot *slot = _userData.findOrInsert(target.action_ID);
+        if(!slot)
+        {
+            yError("TickServer_withData: no room for the data of action %d", target.action_ID);
+            return;
+        }
+        slot->destroy();
+        slot->construct();
     }
 
-    void setData(ActionID id, T& data)
+    void onActionFinished(const yarp::BT_wrappers::ActionID &target, ReturnStatus status) override
     {
-        userData[id] = data;
+        Slot *slot = _userData.find(target.action_ID);
+        if(slot)
+            slot->destroy();
     }
 
+private:
+    // raw storage for a T, the object lives only while the action is running
+    struct Slot
+    {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        bool constructed {false};
+
+        T* get() { return reinterpret_cast<T*>(&storage); }
+
+        template <typename... Args>
+        void construct(Args&&... args)
+        {
+            ::new (static_cast<void*>(&storage)) T(std::forward<Args>(args)...);
+            constructed = true;
+        }
+
+        void destroy()
+        {
+            if(constructed)
+                get()->~T();
+            constructed = false;
+        }
+    };
+
+    ActionTable<Slot> _userData {MAX_ACTIONS};
+
+    Slot* slotOf(const yarp::BT_wrappers::ActionID &id)
+    {
+        Slot *slot = _userData.findOrInsert(id.action_ID);
+        if(!slot)
+            throw std::length_error("TickServer_withData: no room for the data of action " + std::to_string(id.action_ID));
+        return slot;
+    }
 };
 
 }}  // close namespaces
@@ -0,0 +1,150 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file tick_stats.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "tick_stats.h"
+
+using namespace yarp::os;
+using namespace yarp::BT_wrappers;
+
+constexpr int LatencyHistogram::NUM_BUCKETS;
+constexpr int TickCounters::NUM_STATUS;
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+int LatencyHistogram::bucketOf(std::uint64_t us)
+{
+    if(us < LINEAR_BUCKETS)
+        return static_cast<int>(us);
+
+    int exponent = 63 - __builtin_clzll(us);     // us >= 16, so exponent >= 4
+    if(exponent >= MAX_EXPONENT)
+        return NUM_BUCKETS - 1;
+
+    int sub = static_cast<int>((us >> (exponent - 3)) & (SUB_BUCKETS - 1));
+    return LINEAR_BUCKETS + (exponent - 4) * SUB_BUCKETS + sub;
+}
+
+std::uint64_t LatencyHistogram::upperBoundOf(int bucket)
+{
+    if(bucket < LINEAR_BUCKETS)
+        return static_cast<std::uint64_t>(bucket);
+
+    int exponent = (bucket - LINEAR_BUCKETS) / SUB_BUCKETS + 4;
+    int sub      = (bucket - LINEAR_BUCKETS) % SUB_BUCKETS;
+    std::uint64_t width = 1ull << (exponent - 3);
+    return (SUB_BUCKETS + sub) * width + width - 1;
+}
+
+void LatencyHistogram::record(std::chrono::steady_clock::duration duration)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    recordMicroseconds(us > 0 ? static_cast<std::uint64_t>(us) : 0);
+}
+
+void LatencyHistogram::recordMicroseconds(std::uint64_t us)
+{
+    _buckets[bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(us, std::memory_order_relaxed);
+
+    std::uint64_t current = _max.load(std::memory_order_relaxed);
+    while(us > current && !_max.compare_exchange_weak(current, us, std::memory_order_relaxed))
+    { }
+}
+
+void LatencyHistogram::reset()
+{
+    for(auto &bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    _count = 0;
+    _sum   = 0;
+    _max   = 0;
+}
+
+double LatencyHistogram::mean() const
+{
+    std::uint64_t n = _count;
+    return n ? static_cast<double>(_sum) / n : 0.0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double p) const
+{
+    // buckets are read while other threads may be recording: the result is approximate anyway
+    std::uint64_t total = 0;
+    for(const auto &bucket : _buckets)
+        total += bucket.load(std::memory_order_relaxed);
+    if(total == 0)
+        return 0;
+
+    std::uint64_t rank = static_cast<std::uint64_t>(p / 100.0 * total + 0.5);
+    if(rank == 0)
+        rank = 1;
+
+    std::uint64_t seen = 0;
+    for(int i=0; i<NUM_BUCKETS; i++)
+    {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if(seen >= rank)
+        {
+            std::uint64_t bound = upperBoundOf(i);
+            std::uint64_t max   = _max;
+            return bound < max ? bound : max;
+        }
+    }
+    return _max;
+}
+
+void LatencyHistogram::toProperty(Property &prop) const
+{
+    prop.put("count", Value::makeInt64(count()));
+    prop.put("mean",  Value(mean()));
+    prop.put("p50",   Value::makeInt64(percentile(50)));
+    prop.put("p90",   Value::makeInt64(percentile(90)));
+    prop.put("p99",   Value::makeInt64(percentile(99)));
+    prop.put("p999",  Value::makeInt64(percentile(99.9)));
+    prop.put("max",   Value::makeInt64(max()));
+}
+
+
+TickCounters::TickCounters()
+{
+    reset();
+}
+
+void TickCounters::countReply(ReturnStatus status)
+{
+    int index = static_cast<int>(status);
+    if(index >= 0 && index < NUM_STATUS)
+        _replies[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+void TickCounters::reset()
+{
+    _ticks    = 0;
+    _halts    = 0;
+    _rejected = 0;
+    for(auto &reply : _replies)
+        reply = 0;
+}
+
+void TickCounters::toProperty(Property &prop) const
+{
+    ReturnStatusVocab vocab;
+    prop.put("ticks",    Value::makeInt64(_ticks));
+    prop.put("halts",    Value::makeInt64(_halts));
+    prop.put("rejected", Value::makeInt64(_rejected));
+    for(int i=0; i<NUM_STATUS; i++)
+        prop.put("reply_" + vocab.toString(i), Value::makeInt64(_replies[i]));
+}
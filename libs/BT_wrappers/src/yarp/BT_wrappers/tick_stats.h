@@ -0,0 +1,103 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file tick_stats.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_TICK_STATS_H
+#define YARP_BT_MODULES_TICK_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+#include <yarp/os/Property.h>
+#include <yarp/BT_wrappers/ReturnStatus.h>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The LatencyHistogram class    Lock-free histogram of durations, in microseconds.
+ *
+ * Buckets are log-linear (HDR-like): values below 16us have their own bucket, above that
+ * each power of two is split in 8 sub-buckets, so the relative error of percentiles is
+ * below 12.5% over the whole range. Recording a value costs a few atomic increments.
+ */
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void record(std::chrono::steady_clock::duration duration);
+    void recordMicroseconds(std::uint64_t us);
+    void reset();
+
+    std::uint64_t count() const { return _count; }
+    std::uint64_t max() const   { return _max; }
+    double        mean() const;
+
+    /**
+     * @brief percentile    Estimate of the duration below which <p> percent of the values fall.
+     * @param p             percentile, in range [0, 100]
+     */
+    std::uint64_t percentile(double p) const;
+
+    /**
+     * @brief toProperty    Write count, mean, max and main percentiles into <prop>
+     */
+    void toProperty(yarp::os::Property &prop) const;
+
+private:
+    static constexpr int LINEAR_BUCKETS = 16;
+    static constexpr int SUB_BUCKETS    = 8;
+    static constexpr int MAX_EXPONENT   = 40;   // about 12 days, in us
+    static constexpr int NUM_BUCKETS    = LINEAR_BUCKETS + (MAX_EXPONENT - 4) * SUB_BUCKETS + 1;  // last one for overflows
+
+    static int           bucketOf(std::uint64_t us);
+    static std::uint64_t upperBoundOf(int bucket);
+
+    std::atomic<std::uint64_t> _buckets[NUM_BUCKETS];
+    std::atomic<std::uint64_t> _count {0};
+    std::atomic<std::uint64_t> _sum {0};
+    std::atomic<std::uint64_t> _max {0};
+};
+
+/**
+ * @brief The TickCounters class    Counters of requests and of the replies given for each ReturnStatus.
+ */
+class TickCounters
+{
+public:
+    TickCounters();
+
+    void countTick()    { _ticks++; }
+    void countHalt()    { _halts++; }
+    void countRejected(){ _rejected++; }
+    void countReply(ReturnStatus status);
+    void reset();
+
+    /**
+     * @brief toProperty    Write the counters into <prop>, replies are stored as "reply_<STATUS>"
+     */
+    void toProperty(yarp::os::Property &prop) const;
+
+private:
+    static constexpr int NUM_STATUS = BT_ERROR + 1;
+
+    std::atomic<std::uint64_t> _ticks {0};
+    std::atomic<std::uint64_t> _halts {0};
+    std::atomic<std::uint64_t> _rejected {0};
+    std::atomic<std::uint64_t> _replies[NUM_STATUS];
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_TICK_STATS_H
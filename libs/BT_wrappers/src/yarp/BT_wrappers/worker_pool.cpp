@@ -0,0 +1,135 @@
+/******************************************************************************
+*                                                                            *
+* Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+* All Rights Reserved.                                                       *
+*                                                                            *
+******************************************************************************/
+/**
+ * @file worker_pool.cpp
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#include "worker_pool.h"
+
+using namespace yarp::BT_wrappers;
+
+WorkerPool::~WorkerPool()
+{
+    stop();
+}
+
+bool WorkerPool::start(size_t poolSize, size_t queueSize, bool rejectWhenSaturated)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_running || poolSize == 0)
+        return false;
+
+    _queueSize = queueSize;
+    _rejectWhenSaturated = rejectWhenSaturated;
+    _running = true;
+
+    _workers.reserve(poolSize);
+    for(size_t i=0; i<poolSize; i++)
+        _workers.emplace_back(&WorkerPool::run, this);
+
+    return true;
+}
+
+void WorkerPool::stop()
+{
+    std::deque<Job> discarded;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(!_running)
+            return;
+        _running = false;
+        discarded.swap(_queue);
+    }
+    _cv_job.notify_all();
+    _cv_space.notify_all();
+
+    // jobs never started, whoever waits for them is told they are over
+    for(auto &job : discarded)
+    {
+        if(job.onDiscard)
+            job.onDiscard();
+    }
+
+    for(auto &worker : _workers)
+    {
+        if(worker.joinable())
+            worker.join();
+    }
+    _workers.clear();
+}
+
+bool WorkerPool::submit(std::function<void()> job, std::function<void()> onDiscard)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if(!_running)
+        return false;
+
+    // A job is accepted when a worker is free even if the queue size is zero
+    auto has_space = [this] { return !_running || (_queue.size() + _busy) < (_queueSize + _workers.size()); };
+
+    if(!has_space())
+    {
+        if(_rejectWhenSaturated)
+            return false;
+        _cv_space.wait(lock, has_space);
+        if(!_running)
+            return false;
+    }
+
+    _queue.push_back(Job{std::move(job), std::move(onDiscard)});
+    lock.unlock();
+    _cv_job.notify_one();
+    return true;
+}
+
+void WorkerPool::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true)
+    {
+        _cv_job.wait(lock, [this] { return !_running || !_queue.empty(); });
+        if(!_running)
+            return;
+
+        Job job = std::move(_queue.front());
+        _queue.pop_front();
+        _busy++;
+        lock.unlock();
+
+        job.run();
+
+        lock.lock();
+        _busy--;
+        _cv_space.notify_one();
+    }
+}
+
+size_t WorkerPool::poolSize() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _workers.size();
+}
+
+size_t WorkerPool::queueSize() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _queueSize;
+}
+
+size_t WorkerPool::queueDepth() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _queue.size();
+}
+
+size_t WorkerPool::busyWorkers() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _busy;
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (C) 2017 Fondazione Istituto Italiano di Tecnologia (IIT)        *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @file worker_pool.h
+ * @authors: Michele Colledanchise <michele.colledanchise@iit.it>
+ *           Alberto Cardellino <alberto.cardellino@iit.it>
+ */
+
+#ifndef YARP_BT_MODULES_WORKER_POOL_H
+#define YARP_BT_MODULES_WORKER_POOL_H
+
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace yarp {
+namespace BT_wrappers {
+
+/**
+ * @brief The WorkerPool class  Fixed set of threads consuming jobs from a bounded queue.
+ *                              Used by the threaded TickServer to run user's `request_tick`
+ *                              without creating a new thread for every action started.
+ */
+class WorkerPool
+{
+public:
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief start         Spawn the worker threads.
+     * @param poolSize      number of worker threads. Must be greater than zero.
+     * @param queueSize     max number of jobs waiting for a free worker.
+     * @param rejectWhenSaturated   if true `submit` fails immediately when the queue is full,
+     *                      otherwise it blocks the caller until a slot is available.
+     * @return              true if the pool was started, false otherwise
+     */
+    bool start(size_t poolSize, size_t queueSize, bool rejectWhenSaturated);
+
+    /**
+     * @brief stop          Discard queued jobs and wait for the running ones to terminate.
+     *                      The <onDiscard> callback of each discarded job is called instead of the job,
+     *                      by the thread calling stop.
+     */
+    void stop();
+
+    /**
+     * @brief submit        Enqueue a job for execution.
+     * @param onDiscard     called if the pool is stopped before the job starts, e.g. to notify who
+     *                      is waiting for the job to complete.
+     * @return              false if the pool is not running or if the job was rejected
+     *                      because the queue is full. Neither the job nor <onDiscard> are called then.
+     */
+    bool submit(std::function<void()> job, std::function<void()> onDiscard = {});
+
+    size_t poolSize() const;
+    size_t queueSize() const;
+    size_t queueDepth() const;      // jobs currently waiting for a worker
+    size_t busyWorkers() const;     // jobs currently being executed
+
+private:
+    void run();
+
+    struct Job
+    {
+        std::function<void()>   run;
+        std::function<void()>   onDiscard;
+    };
+
+    std::vector<std::thread>            _workers;
+    std::deque<Job>                     _queue;
+    size_t                  _queueSize {0};
+    size_t                  _busy {0};
+    bool                    _rejectWhenSaturated {false};
+    bool                    _running {false};
+
+    mutable std::mutex      _mutex;
+    std::condition_variable _cv_job;
+    std::condition_variable _cv_space;
+};
+
+}}  // close namespaces
+
+#endif // YARP_BT_MODULES_WORKER_POOL_H
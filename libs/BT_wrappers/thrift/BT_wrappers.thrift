@@ -43,6 +43,35 @@ struct ActionID {
     3: i32 action_ID;
 }
 
+/**
+ * The ActionStatus is published by a TickServer on its status:o port whenever
+ * an action executed in threaded mode finishes, so that clients can stop
+ * polling the server while the action is running.
+ *
+ * Fields are:
+ * action_ID: the action_ID of the ActionID the status refers to.
+ * status: the value returned by the server's request_tick routine.
+ * seq: sequence number of the message, incremented by the server at each publication.
+ */
+struct ActionStatus {
+    1: i32 action_ID;
+    2: ReturnStatus status;
+    3: i64 seq;
+}
+
+/**
+ * The TickReply is returned by tick_versioned.
+ *
+ * Fields are:
+ * status: the status of the action, as returned by request_tick.
+ * params_needed: true if the server does not have the params with the version sent by the client,
+ *         so the action was not ticked and the client must send the tick again with the params.
+ */
+struct TickReply {
+    1: ReturnStatus status;
+    2: bool params_needed;
+}
+
 service BT_request {
 
     /**
@@ -84,6 +113,59 @@ service BT_request {
      */
      ReturnStatus request_halt  (1:ActionID target, 2: Params params = {});
 
+    /**
+     * request_batch_tick  Send the Tick requests of several actions handled by this server in a single message.
+     *                      It is equivalent to calling request_tick for each element of <targets>, in order,
+     *                      but it costs a single round trip.
+     *
+     * targets       The actions to tick.
+     * params        The parameters of each action, matched to <targets> by position.
+     *                      If shorter than <targets>, missing entries are empty.
+     * return              The status of each action, in the same order as <targets>.
+     */
+    list<ReturnStatus> request_batch_tick(1:list<ActionID> targets, 2: list<Params> params);
+
+
+    /**
+     * register_target  Bind an ActionID to a compact handle, to be used by the *_handle methods below
+     *                      instead of sending the whole ActionID at every call.
+     *                      Registering again the same ActionID returns the same handle.
+     *
+     * target        The ActionID to register.
+     * return              The handle, greater than zero; zero if the server cannot register more targets.
+     */
+    i32 register_target(1:ActionID target);
+
+    /**
+     * tick_handle  Same as request_tick, for the ActionID registered with <handle>.
+     * return              The enum indicating the status of the action; BT_ERROR if the handle is unknown.
+     */
+    ReturnStatus tick_handle(1:i32 handle, 2: Params params = {});
+
+    /**
+     * tick_versioned  Same as tick_handle, sending the params only when they change.
+     *                      The server keeps the last params received for each action along with their version,
+     *                      and uses them when the client sends the same version again without params.
+     *
+     * handle        The handle of the action, from register_target.
+     * version       The version of the params, e.g. a hash of their content.
+     * with_params   true if <params> are sent, false to use the ones the server already has for <version>.
+     * params        The params of the tick, only if <with_params> is true.
+     * return              The status of the action, or params_needed set if the server does not have <version>.
+     */
+    TickReply tick_versioned(1:i32 handle, 2:i64 version, 3:bool with_params, 4: Params params = {});
+
+    /**
+     * halt_handle  Same as request_halt, for the ActionID registered with <handle>.
+     * return              The enum indicating the status of the action; BT_ERROR if the handle is unknown.
+     */
+    ReturnStatus halt_handle(1:i32 handle, 2: Params params = {});
+
+    /**
+     * status_handle  Same as request_status, for the ActionID registered with <handle>.
+     * return              The enum indicating the status of the action; BT_ERROR if the handle is unknown.
+     */
+    ReturnStatus status_handle(1:i32 handle);
 
     /**
      *  request_initialize  Hook for an initialization callback. The client can ask the action server to perform
@@ -97,4 +179,18 @@ service BT_request {
      * return              true if the call was successful, false otherwise
      */
     bool request_terminate ();
+
+    /**
+     * request_stats  Get the statistics collected by the server since start or last reset:
+     *                      number of ticks and halts, number of replies for each ReturnStatus,
+     *                      and the latency histograms of tick handling, user code and queueing, in microseconds.
+     * return              A Property with one entry for each counter and one group for each histogram.
+     */
+    Params request_stats();
+
+    /**
+     * reset_stats  Clear all the statistics collected by the server.
+     * return              true if the call was successful, false otherwise
+     */
+    bool reset_stats();
 }
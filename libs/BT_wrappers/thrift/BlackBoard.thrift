@@ -14,11 +14,167 @@ struct Data { }
   yarp.includefile="yarp/os/Property.h"
 )
 
+/**
+ * Data to be merged into a target: a Property that keeps the entries it was read from,
+ * so the blackboard merges them without text conversions.
+ */
+struct DataEntries { }
+(
+  yarp.name = "yarp::BT_wrappers::PropertyEntries"
+  yarp.includefile="yarp/BT_wrappers/property_merge.h"
+)
+
+struct DataValue { }
+(
+  yarp.name = "yarp::os::Value"
+  yarp.includefile="yarp/os/Value.h"
+)
+
+/**
+ * The DataUpdate is published by the blackboard on its updates:o port whenever
+ * a watched target is modified, see watch().
+ *
+ * Fields are:
+ * target: the target modified.
+ * version: increased at each modification of the blackboard, a newer update has a greater version.
+ * reset: if true, the previous content of the target is dropped before applying delta,
+ *        e.g. when the target has been cleared or reset. Otherwise delta is merged as in setData.
+ * delta: the data changed.
+ */
+struct DataUpdate {
+    1: string target;
+    2: i64 version;
+    3: bool reset;
+    4: Data delta;
+}
+
+/**
+ * The VersionedData is returned by getDataIfChanged.
+ *
+ * Fields are:
+ * version: version of the target, i.e. of its last modification. 0 if the target does not exist.
+ * changed: false if the target still has the version known by the caller, data is empty then.
+ * data: the content of the target, if changed.
+ */
+struct VersionedData {
+    1: i64 version;
+    2: bool changed;
+    3: Data data;
+}
+
+/**
+ * The SpatialMatch is returned by the spatial queries, findInRadius and findNearest.
+ *
+ * Fields are:
+ * target: the target found.
+ * distance: distance of its position from the point asked for.
+ * data: the content of the target.
+ */
+struct SpatialMatch {
+    1: string target;
+    2: double distance;
+    3: Data data;
+}
+
+/**
+ * The TargetPage is a page of the targets returned by listTargets and scan, in alphabetical order.
+ *
+ * Fields are:
+ * targets: the targets of this page.
+ * data: the content of each target, only for scan.
+ * cursor: to be passed to the following call to get the next page, empty if this is the last one.
+ */
+struct TargetPage {
+    1: list<string> targets;
+    2: list<Data> data;
+    3: string cursor;
+}
+
 service BlackBoardWrapper {
     Data getData(1: string target)
-    bool setData(1: string target, 2: Data datum)
+
+    /**
+     * Get the content of <target> only if its version differs from <knownVersion>.
+     * Targets not existing are always reported as changed.
+     */
+    VersionedData getDataIfChanged(1: string target, 2: i64 knownVersion)
+    bool setData(1: string target, 2: DataEntries datum)
+
+    /**
+     * Merge <datum> into <target> as setData, then drop the whole target <ttl> seconds later.
+     * A <ttl> of zero or less removes the expiration of <target>; setData leaves it as it is.
+     */
+    bool setDataWithTTL(1: string target, 2: DataEntries datum, 3: double ttl)
+
+    /**
+     * Get the value of the field <key> of <target>, a null Value if missing.
+     */
+    DataValue getField(1: string target, 2: string key)
+
+    /**
+     * Set the field <key> of <target> to <value>, leaving the other fields as they are.
+     */
+    bool setField(1: string target, 2: string key, 3: DataValue value)
+
+    /**
+     * Get the content of several targets at once, in the same order as <targets>.
+     * The contents are read together, so they are consistent with each other.
+     */
+    list<Data> getMany(1: list<string> targets)
+
+    /**
+     * Merge data[i] into targets[i], as setData, for all i at once.
+     * The writes are applied together: readers see either none or all of them.
+     * Returns false, without writing anything, if the lists have different sizes.
+     */
+    bool setMany(1: list<string> targets, 2: list<Data> data)
     void clearData(1: string target)
     void clearAll()
     void resetData()
     list<string> listTarget()
+
+    /**
+     * The targets starting with <prefix>, in alphabetical order, at most <limit> at a time (all if zero or less).
+     * <cursor> is empty for the first page, then the cursor of the previous page.
+     */
+    TargetPage listTargets(1: string prefix, 2: i32 limit, 3: string cursor)
+
+    /**
+     * As listTargets, also returning the content of each target.
+     */
+    TargetPage scan(1: string prefix, 2: i32 limit, 3: string cursor)
+
+    /**
+     * Memory used by the blackboard, as (entries N) (bytes N) (max_bytes N) (evictions N) (expirations N).
+     * max_bytes is 0 if there is no memory budget. bytes is an estimate, computed from the structure of the
+     * values of the targets not in the initial values.
+     */
+    Data getMemoryStats()
+
+    /**
+     * Targets with a position on map <mapId> within <radius> of (x, y, z), the nearest first.
+     * A target has a position if it contains either (pose (x y z)), with an optional (map_id name),
+     * or (location (map_id name) (x x) (y y)), with an optional (z z). Positions without a map_id
+     * are on map "".
+     */
+    list<SpatialMatch> findInRadius(1: string mapId, 2: double x, 3: double y, 4: double z, 5: double radius)
+
+    /**
+     * The <count> targets with a position on map <mapId> nearest to (x, y, z), the nearest first.
+     */
+    list<SpatialMatch> findNearest(1: string mapId, 2: double x, 3: double y, 4: double z, 5: i32 count)
+
+    /**
+     * Publish the changes of the targets matching <pattern> on the updates:o port, for <subscriber>,
+     * i.e. the name of the port it connected to updates:o.
+     * <pattern> is either a target name or a prefix followed by '*'. Watching it again from the same
+     * subscriber has no effect. The current content of the matching targets is published right away.
+     */
+    bool watch(1: string pattern, 2: string subscriber)
+
+    /**
+     * Stop watching <pattern> for <subscriber>. The changes keep being published while other
+     * subscribers watch it, or the same subscriber through another pattern.
+     */
+    bool unwatch(1: string pattern, 2: string subscriber)
 }
@@ -12,18 +12,35 @@
 
 //standard imports
 #include <map>
+#include <set>
 #include <mutex>
+#include <memory>
+#include <atomic>
+#include <shared_mutex>
+#include <functional>
 #include <chrono>
+#include <vector>
 #include <iostream>
 #include <algorithm>
+#include <queue>
+#include <deque>
+#include <limits>
+#include <thread>
+#include <condition_variable>
 
 //YARP imports
+#include <yarp/os/Time.h>
 #include <yarp/os/Network.h>
 #include <yarp/os/LogStream.h>
+#include <yarp/os/BufferedPort.h>
 
 //behavior trees imports
 #include <yarp/BT_wrappers/tick_server.h>
 #include <yarp/BT_wrappers/BlackBoardWrapper.h>
+#include <yarp/BT_wrappers/DataUpdate.h>
+#include <yarp/BT_wrappers/property_merge.h>
+#include <yarp/BT_wrappers/blackboard_journal.h>
+#include <yarp/BT_wrappers/spatial_index.h>
 
 
 using namespace yarp::os;
@@ -34,22 +51,615 @@ class BlackBoard :  public BlackBoardWrapper,
                     public RFModule
 {
 private:
+    // Targets are spread over independent shards, so that accesses to different targets do not contend,
+    // and readers of the same shard do not block each other.
+    static constexpr size_t NUM_SHARDS = 16;
+
+    // how often the subscribers of the updates are checked to be still connected, in seconds
+    static constexpr double SUBSCRIBERS_CHECK_PERIOD = 5.0;
+
+    using Storage  = BlackBoardJournal::Storage;
+    using Expiries = BlackBoardJournal::Expiries;
+
+    struct Entry
+    {
+        Property        data;
+        std::int64_t    version {0};    // value of m_version at the last modification
+        bool            erased {false}; // target of the base image cleared after the last reset
+        double          expiry {0.0};   // time after which the target is dropped, 0 if it never expires
+        size_t          bytes {0};      // memory accounted to the target, see account()
+        mutable std::atomic<double> lastAccess {0.0};   // updated only with a memory budget
+    };
+
+    // The shards hold the targets written after the last reset, layered over an immutable base image,
+    // i.e. the initial values: a reset drops the shards content and the first write to a target of
+    // the base image copies only that target.
+    struct Shard
+    {
+        mutable std::shared_timed_mutex     mutex;
+        std::map<std::string, Entry>        storage;
+        size_t                              expiring {0};   // entries with an expiry
+    };
+
     yarp::os::Port                  m_blackboard_port;  // a port to handle RPC  messages
-    std::map<std::string, Property> m_storage;
-    std::map<std::string, Property> m_initialization_values;
-    std::mutex                      m_mutex;
+    Shard                           m_shards[NUM_SHARDS];
+    std::shared_ptr<const Storage>  m_initialValues {std::make_shared<const Storage>()};
+    std::shared_ptr<const Storage>  m_base {m_initialValues};  // replaced only with all the shards locked
+    std::int64_t                    m_baseVersion {0};          // version of the targets of the base image
+    std::atomic<std::int64_t>       m_version {0};
+    bool                            m_verbose {false};
+    double                          m_period {1.0};
+
+    // Durable storage, if enabled with --persistence_dir. Modifications are logged while holding the
+    // lock of the shard, in the same order they are applied.
+    BlackBoardJournal               m_journal;
+    bool                            m_persistent {false};   // --persistence_dir given
+    double                          m_snapshotPeriod {60.0};
+    std::uint64_t                   m_snapshotRecords {10000};
+    double                          m_lastSnapshot {0.0};
+
+    // Memory budget, if set with --max_bytes: when the memory used by the targets not in the initial values
+    // exceeds it, they are evicted starting from the least recently used one. Expired targets are dropped by
+    // updateModule, and are already invisible before.
+    std::int64_t                    m_maxBytes {0};
+    std::atomic<std::int64_t>       m_bytes {0};        // memory accounted to the evictable targets
+    std::atomic<std::uint64_t>      m_evictions {0};
+    std::atomic<std::uint64_t>      m_expirations {0};
+    std::mutex                      m_evictMutex;
+
+    // Targets carrying a position, updated while holding the lock of the shard. The index is never locked
+    // before a shard: queries release it before reading the targets found.
+    std::unique_ptr<SpatialIndex>   m_index {new SpatialIndex()};
+
+    // Changes of the watched targets are published here. Updates are queued while holding the lock of
+    // the shard, so those of a target are sent in the same order they are applied, and written by
+    // m_updatesThread: writers never wait for the network with the shards locked.
+    yarp::os::BufferedPort<DataUpdate>  m_updates_port;
+    std::mutex                          m_updatesMutex;
+    std::condition_variable             m_updatesCv;
+    std::deque<DataUpdate>              m_pendingUpdates;
+    bool                                m_publishing {false};
+    std::thread                         m_updatesThread;
+    // Each subscriber, i.e. the port it connected to m_updates_port (one per BT engine process), watches a set
+    // of patterns; a pattern is watched as long as a subscriber watches it. Subscribers whose port is no more
+    // connected are forgotten by updateModule
+    mutable std::shared_timed_mutex                 m_watchMutex;
+    std::map<std::string, int>                      m_watched;          // pattern -> number of subscribers
+    std::map<std::string, std::set<std::string>>    m_subscribers;      // subscriber -> patterns
+    std::atomic<bool>                               m_anyWatched {false};
+    double                                          m_lastSubscribersCheck {0.0};
+
+    static size_t shardIndex(const std::string &target)
+    {
+        return std::hash<std::string>{}(target) % NUM_SHARDS;
+    }
+
+    Shard& shardOf(const std::string &target)
+    {
+        return m_shards[shardIndex(target)];
+    }
+
+    // Shards holding <targets>, in increasing order: operations on several shards lock them in this order
+    static std::vector<size_t> shardsOf(const std::vector<std::string> &targets)
+    {
+        std::vector<size_t> shards;
+        for(const auto &target : targets)
+            shards.push_back(shardIndex(target));
+        std::sort(shards.begin(), shards.end());
+        shards.erase(std::unique(shards.begin(), shards.end()), shards.end());
+        return shards;
+    }
+
+    // true if <target> matches <pattern>, i.e. a target name or a prefix followed by '*'
+    static bool matches(const std::string &pattern, const std::string &target)
+    {
+        if(!pattern.empty() && pattern.back() == '*')
+            return target.compare(0, pattern.size()-1, pattern, 0, pattern.size()-1) == 0;
+        return pattern == target;
+    }
+
+    bool isWatched(const std::string &target) const
+    {
+        if(!m_anyWatched)
+            return false;
+
+        std::shared_lock<std::shared_timed_mutex> lock(m_watchMutex);
+        for(const auto &pattern : m_watched)
+        {
+            if(matches(pattern.first, target))
+                return true;
+        }
+        return false;
+    }
+
+    // to be called with the lock of the shard of <target> held
+    void publishUpdate(const std::string &target, std::int64_t version, bool reset, const Property &delta)
+    {
+        if(!isWatched(target) || m_updates_port.getOutputCount() == 0)
+            return;
+
+        DataUpdate msg;
+        msg.target  = target;
+        msg.version = version;
+        msg.reset   = reset;
+        msg.delta   = delta;
+        {
+            std::lock_guard<std::mutex> lock(m_updatesMutex);
+            m_pendingUpdates.push_back(std::move(msg));
+        }
+        m_updatesCv.notify_one();
+    }
+
+    // body of m_updatesThread: write the queued updates, in order, until close
+    void runUpdates()
+    {
+        std::deque<DataUpdate> sending;
+        std::unique_lock<std::mutex> lock(m_updatesMutex);
+        while(m_publishing || !m_pendingUpdates.empty())
+        {
+            m_updatesCv.wait(lock, [this]{ return !m_publishing || !m_pendingUpdates.empty(); });
+            sending.swap(m_pendingUpdates);
+            lock.unlock();
+
+            for(auto &update : sending)
+            {
+                m_updates_port.prepare() = std::move(update);
+                // updates are deltas, none of them can be dropped
+                m_updates_port.write(true);
+            }
+            sending.clear();
+            lock.lock();
+        }
+    }
+
+    std::vector<std::shared_lock<std::shared_timed_mutex>> lockAllShared() const
+    {
+        std::vector<std::shared_lock<std::shared_timed_mutex>> locks;
+        for(const auto &shard : m_shards)
+            locks.emplace_back(shard.mutex);
+        return locks;
+    }
+
+    std::vector<std::unique_lock<std::shared_timed_mutex>> lockAll()
+    {
+        std::vector<std::unique_lock<std::shared_timed_mutex>> locks;
+        for(auto &shard : m_shards)
+            locks.emplace_back(shard.mutex);
+        return locks;
+    }
+
+    static bool isExpired(const Entry &entry, double now)
+    {
+        return entry.expiry > 0.0 && now >= entry.expiry;
+    }
+
+    // Content of <target>, nullptr if missing. To be called with the lock of its shard held
+    const Property* lookup(const Shard &shard, const std::string &target, std::int64_t *version = nullptr) const
+    {
+        auto entry = shard.storage.find(target);
+        if(entry != shard.storage.end())
+        {
+            if(entry->second.erased || (entry->second.expiry > 0.0 && isExpired(entry->second, Time::now())))
+                return nullptr;
+            if(m_maxBytes > 0)
+                entry->second.lastAccess = Time::now();
+            if(version)
+                *version = entry->second.version;
+            return &entry->second.data;
+        }
+
+        auto base = m_base->find(target);
+        if(base == m_base->end())
+            return nullptr;
+        if(version)
+            *version = m_baseVersion;
+        return &base->second;
+    }
+
+    // Entry of <target> to be modified, copied from the base image at the first write.
+    // To be called with the lock of its shard held for writing
+    Entry& writable(Shard &shard, const std::string &target)
+    {
+        auto entry = shard.storage.find(target);
+        if(entry != shard.storage.end())
+        {
+            entry->second.erased = false;
+            return entry->second;
+        }
+
+        Entry &created = shard.storage[target];
+        auto base = m_base->find(target);
+        if(base != m_base->end())
+            created.data = base->second;
+        return created;
+    }
+
+    // Update the memory accounted to <target> after a modification changing its estimated size by <growth> bytes
+    // (see mergeGrowth), to be called with its shard locked. Only the targets not in the initial values are
+    // accounted, since only those can be evicted
+    void account(const std::string &target, Entry &entry, std::int64_t growth)
+    {
+        if(m_initialValues->find(target) != m_initialValues->end())
+            return;
+
+        std::int64_t previous = static_cast<std::int64_t>(entry.bytes);
+        std::int64_t bytes    = (previous == 0 ? static_cast<std::int64_t>(target.size()) : previous) + growth;
+        bytes = std::max(bytes, static_cast<std::int64_t>(target.size()));
+        m_bytes    += bytes - previous;
+        entry.bytes = static_cast<size_t>(bytes);
+        if(m_maxBytes > 0)
+            entry.lastAccess = Time::now();
+    }
+
+    void setExpiry(Shard &shard, Entry &entry, double expiry)
+    {
+        if(entry.expiry > 0.0)
+            shard.expiring--;
+        if(expiry > 0.0)
+            shard.expiring++;
+        entry.expiry = expiry;
+    }
+
+    // Drop <target>, to be called with its shard locked for writing
+    void drop(Shard &shard, const std::string &target)
+    {
+        std::int64_t version = ++m_version;
+        auto entry = shard.storage.find(target);
+        if(entry != shard.storage.end())
+        {
+            m_bytes -= static_cast<std::int64_t>(entry->second.bytes);
+            setExpiry(shard, entry->second, 0.0);
+        }
+
+        if(m_base->find(target) != m_base->end())
+        {
+            // hide the target of the base image until next reset
+            Entry &hidden  = shard.storage[target];
+            hidden.data.clear();
+            hidden.erased  = true;
+            hidden.version = version;
+            hidden.bytes   = 0;
+        }
+        else
+            shard.storage.erase(target);
+        m_index->remove(target);
+
+        if(m_journal.isOpen())
+            m_journal.logClear(target);
+        publishUpdate(target, version, true, Property());
+    }
+
+    // Drop <target> if expired, before writing it, so that a write does not revive the old content
+    void dropIfExpired(Shard &shard, const std::string &target)
+    {
+        auto entry = shard.storage.find(target);
+        if(entry != shard.storage.end() && isExpired(entry->second, Time::now()))
+        {
+            drop(shard, target);
+            m_expirations++;
+        }
+    }
+
+    // Drop the expired targets still stored
+    void expire()
+    {
+        double now = Time::now();
+        for(auto &shard : m_shards)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+            if(shard.expiring == 0)
+                continue;
+
+            std::vector<std::string> expired;
+            for(const auto &entry : shard.storage)
+            {
+                if(isExpired(entry.second, now))
+                    expired.push_back(entry.first);
+            }
+            for(const auto &target : expired)
+                drop(shard, target);
+            m_expirations += expired.size();
+        }
+    }
+
+    // Evict the least recently used targets, until the memory is back under the budget with some margin,
+    // so that the scan is not repeated at each of the following writes. To be called with no shard locked
+    void enforceBudget()
+    {
+        if(m_maxBytes <= 0 || m_bytes <= m_maxBytes)
+            return;
+
+        // a single eviction at a time, the others writers go on
+        std::unique_lock<std::mutex> evicting(m_evictMutex, std::try_to_lock);
+        if(!evicting.owns_lock())
+            return;
+
+        std::vector<std::pair<double, std::string>> candidates;
+        for(const auto &shard : m_shards)
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+            for(const auto &entry : shard.storage)
+            {
+                if(entry.second.bytes > 0)
+                    candidates.emplace_back(entry.second.lastAccess.load(), entry.first);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        std::int64_t goal = m_maxBytes - m_maxBytes / 10;
+        for(const auto &candidate : candidates)
+        {
+            if(m_bytes <= goal)
+                break;
+
+            Shard &shard = shardOf(candidate.second);
+            std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+            // skip the targets dropped or accessed since the scan
+            auto entry = shard.storage.find(candidate.second);
+            if(entry == shard.storage.end() || entry->second.bytes == 0 || entry->second.lastAccess > candidate.first)
+                continue;
+            drop(shard, candidate.second);
+            m_evictions++;
+        }
+    }
+
+    // Call fn(target, data, version) for each target. To be called with all the shards locked
+    template<class F>
+    void forEachTarget(F fn) const
+    {
+        double now = Time::now();
+        for(const auto &base : *m_base)
+        {
+            const Shard &shard = m_shards[shardIndex(base.first)];
+            if(shard.storage.find(base.first) == shard.storage.end())
+                fn(base.first, base.second, m_baseVersion);
+        }
+        for(const auto &shard : m_shards)
+        {
+            for(const auto &entry : shard.storage)
+            {
+                if(!entry.second.erased && !isExpired(entry.second, now))
+                    fn(entry.first, entry.second.data, entry.second.version);
+            }
+        }
+    }
+
+    // Call fn(target, data, version) for the targets starting with <prefix> and following <after>, in
+    // alphabetical order, until fn returns false. To be called with all the shards locked.
+    // The ordered storage of each shard and the base image are merged, starting each one from its first
+    // target in range, so the cost depends on the targets visited, not on all the targets stored
+    template<class F>
+    void forEachInOrder(const std::string &prefix, const std::string &after, F fn) const
+    {
+        double now = Time::now();
+        auto inRange = [&](const std::string &target) { return target.compare(0, prefix.size(), prefix) == 0; };
+        bool afterCursor = !after.empty() && after >= prefix;
+
+        // heads of the shards, then of the base image, the first target first
+        using Head = std::pair<const std::string*, size_t>;
+        auto later = [](const Head &a, const Head &b) { return *a.first > *b.first; };
+        std::priority_queue<Head, std::vector<Head>, decltype(later)> heads(later);
+
+        std::map<std::string, Entry>::const_iterator shardIt[NUM_SHARDS];
+        for(size_t i=0; i<NUM_SHARDS; i++)
+        {
+            const auto &storage = m_shards[i].storage;
+            shardIt[i] = afterCursor ? storage.upper_bound(after) : storage.lower_bound(prefix);
+            if(shardIt[i] != storage.end() && inRange(shardIt[i]->first))
+                heads.emplace(&shardIt[i]->first, i);
+        }
+        Storage::const_iterator baseIt = afterCursor ? m_base->upper_bound(after) : m_base->lower_bound(prefix);
+        if(baseIt != m_base->end() && inRange(baseIt->first))
+            heads.emplace(&baseIt->first, NUM_SHARDS);
+
+        while(!heads.empty())
+        {
+            size_t source = heads.top().second;
+            heads.pop();
+
+            bool more = true;
+            if(source == NUM_SHARDS)
+            {
+                // the targets of the base image written since the last reset are visited in their shard
+                const Shard &shard = m_shards[shardIndex(baseIt->first)];
+                if(shard.storage.find(baseIt->first) == shard.storage.end())
+                    more = fn(baseIt->first, baseIt->second, m_baseVersion);
+                if(++baseIt != m_base->end() && inRange(baseIt->first))
+                    heads.emplace(&baseIt->first, NUM_SHARDS);
+            }
+            else
+            {
+                auto &it = shardIt[source];
+                if(!it->second.erased && !isExpired(it->second, now))
+                    more = fn(it->first, it->second.data, it->second.version);
+                if(++it != m_shards[source].storage.end() && inRange(it->first))
+                    heads.emplace(&it->first, source);
+            }
+            if(!more)
+                return;
+        }
+    }
+
+    // A page of the targets starting with <prefix>, following <cursor>, with their content if <withData>
+    TargetPage page(const std::string &prefix, std::int32_t limit, const std::string &cursor, bool withData) const
+    {
+        TargetPage ret;
+        size_t max = limit > 0 ? static_cast<size_t>(limit) : std::numeric_limits<size_t>::max();
+        bool more = false;
+        {
+            auto locks = lockAllShared();
+            forEachInOrder(prefix, cursor, [&](const std::string &target, const Property &data, std::int64_t)
+            {
+                if(ret.targets.size() == max)
+                {
+                    more = true;
+                    return false;
+                }
+                ret.targets.push_back(target);
+                if(withData)
+                    ret.data.push_back(data);
+                return true;
+            });
+        }
+        if(more)
+            ret.cursor = ret.targets.back();
+        return ret;
+    }
+
+    // Replace the whole content with <base>, dropping the targets written since the last reset
+    void resetTo(std::shared_ptr<const Storage> base)
+    {
+        std::vector<std::map<std::string, Entry>> dropped(NUM_SHARDS);
+        {
+            auto locks = lockAll();
+
+            if(m_journal.isOpen())
+            {
+                if(base->empty())
+                    m_journal.logClearAll();
+                else
+                    m_journal.logReset();
+            }
+
+            // watchers get the new content of every target changed
+            std::vector<std::string> changed;
+            if(m_anyWatched)
+            {
+                forEachTarget([&](const std::string &target, const Property &, std::int64_t) { changed.push_back(target); });
+                for(const auto &entry : *base)
+                    changed.push_back(entry.first);
+                std::sort(changed.begin(), changed.end());
+                changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+            }
+
+            for(size_t i=0; i<NUM_SHARDS; i++)
+            {
+                dropped[i].swap(m_shards[i].storage);
+                m_shards[i].expiring = 0;
+            }
+            m_bytes       = 0;
+            m_base        = std::move(base);
+            m_baseVersion = ++m_version;
+
+            m_index->clear();
+            for(const auto &entry : *m_base)
+                m_index->update(entry.first, entry.second);
+
+            for(const auto &target : changed)
+            {
+                const Property *data = lookup(shardOf(target), target);
+                publishUpdate(target, data ? m_baseVersion : ++m_version, true, data ? *data : Property());
+            }
+        }
+        // the dropped targets are destroyed out of the locks
+    }
+
+    // Restore the content recovered from the journal, as written over the initial values.
+    // Targets already expired are dropped by the next expire()
+    void restore(const Storage &content, const Expiries &expiries)
+    {
+        // sizes estimated out of the locks, the recovered content is listed through its text
+        std::map<std::string, std::int64_t> sizes;
+        for(const auto &target : content)
+            sizes[target.first] = mergeGrowth(Property(), propertyEntries(target.second));
+
+        auto locks = lockAll();
+        for(const auto &initial : *m_base)
+        {
+            if(content.find(initial.first) == content.end())
+            {
+                Entry &hidden  = shardOf(initial.first).storage[initial.first];
+                hidden.erased  = true;
+                hidden.version = ++m_version;
+            }
+        }
+        for(const auto &target : content)
+        {
+            Shard &shard  = shardOf(target.first);
+            Entry &entry  = writable(shard, target.first);
+            entry.data    = target.second;
+            entry.version = ++m_version;
+            auto expiry = expiries.find(target.first);
+            if(expiry != expiries.end())
+                setExpiry(shard, entry, expiry->second);
+            account(target.first, entry, sizes[target.first]);
+            m_index->update(target.first, entry.data);
+        }
+        for(const auto &initial : *m_base)
+        {
+            if(content.find(initial.first) == content.end())
+                m_index->remove(initial.first);
+        }
+    }
+
+    // Content of the targets found by a spatial query, read together as in getMany.
+    // Targets dropped after the query are left out
+    std::vector<SpatialMatch> readMatches(const std::vector<SpatialIndex::Match> &found) const
+    {
+        std::vector<std::string> targets;
+        targets.reserve(found.size());
+        for(const auto &match : found)
+            targets.push_back(match.target);
+
+        std::vector<std::shared_lock<std::shared_timed_mutex>> locks;
+        for(size_t shard : shardsOf(targets))
+            locks.emplace_back(m_shards[shard].mutex);
+
+        std::vector<SpatialMatch> ret;
+        ret.reserve(found.size());
+        for(const auto &match : found)
+        {
+            const Property *data = lookup(m_shards[shardIndex(match.target)], match.target);
+            if(data)
+                ret.emplace_back(match.target, match.distance, *data);
+        }
+        return ret;
+    }
+
+    // Write the whole content to the snapshot of the journal
+    void takeSnapshot()
+    {
+        Storage  content;
+        Expiries expiries;
+        {
+            // no modification between the copy and the rotation of the log
+            auto locks = lockAllShared();
+            forEachTarget([&](const std::string &target, const Property &data, std::int64_t)
+            {
+                content.emplace(target, data);
+            });
+            // only the targets written since the last reset may expire
+            for(const auto &shard : m_shards)
+            {
+                if(shard.expiring == 0)
+                    continue;
+                for(const auto &entry : shard.storage)
+                {
+                    if(!entry.second.erased && entry.second.expiry > 0.0)
+                        expiries.emplace(entry.first, entry.second.expiry);
+                }
+            }
+            if(!m_journal.rotate())
+                return;
+        }
+        m_journal.writeSnapshot(content, expiries);
+        m_lastSnapshot = yarp::os::Time::now();
+    }
 
 public:
+    // Every node of the BT engine calls it at start up: back to the initial values, unless the blackboard is
+    // persistent (--persistence_dir), whose content restored from the journal must survive the engine start
     bool request_initialize() override
     {
-        resetData();
+        if(!m_persistent)
+            resetData();
         return true;
     }
 
     ReturnStatus request_tick(const ActionID &target, const yarp::os::Property &params = {}) override
     {
-        ReturnStatus ret = BT_ERROR;
-        yInfo() << "Request_tick with target " << target.target << " and params " << params.toString();
+        if(m_verbose)
+            yInfo() << "Request_tick with target " << target.target << " and params " << params.toString();
 
         // get <target> from param
         if(target.target == "")
@@ -57,8 +667,6 @@ public:
             yError() << "Missing <flag> parameter from tick request";
             return BT_ERROR;
         }
-        // if target is missing from blackboard I'll get an empty property ...
-        Property data = getData(target.target);
 
         // get <flag> from param
         if(!params.check("flag"))
@@ -68,16 +676,29 @@ public:
         }
         std::string flagName = params.find("flag").asString();
 
-        // finally get the actual value from data
-        if(!data.check(flagName))
+        // read the flag in place, without copying the whole property of <target>
+        bool found = false;
+        bool flag  = false;
+        {
+            Shard &shard = shardOf(target.target);
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+            const Property *data = lookup(shard, target.target);
+            if(data && data->check(flagName))
+            {
+                found = true;
+                flag  = data->find(flagName).asBool();
+            }
+        }
+
+        if(!found)
         {
             yError() << std::string("Requested flag <") + flagName + " was not found in the blackboard for target <" + target.target + ">.";
             return BT_ERROR;
         }
 
-        ReturnStatusVocab a;
-        data.find(flagName).asBool() ? ret = BT_SUCCESS : ret = BT_FAILURE;
-        yInfo() << "result is " << a.toString(ret);
+        ReturnStatus ret = flag ? BT_SUCCESS : BT_FAILURE;
+        if(m_verbose)
+            yInfo() << "result is " << ReturnStatusVocab().toString(ret);
         return ret;
     }
 
@@ -87,84 +708,393 @@ public:
         return BT_HALTED;
     }
 
+    // if target is missing from blackboard I'll get an empty property
     yarp::os::Property getData(const std::string& target) override
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        Property p = m_storage[target];
-        yInfo() << "getData with target " << p.toString();
-        return m_storage[target];
+        Shard &shard = shardOf(target);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        const Property *data = lookup(shard, target);
+        if(!data)
+            return Property();
+
+        if(m_verbose)
+            yInfo() << "getData with target " << target << " : " << data->toString();
+        return *data;
+    }
+
+    yarp::os::Value getField(const std::string& target, const std::string& key) override
+    {
+        Shard &shard = shardOf(target);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        const Property *data = lookup(shard, target);
+        if(!data || !data->check(key))
+            return Value();
+        return data->find(key);
+    }
+
+    bool setField(const std::string& target, const std::string& key, const yarp::os::Value& value) override
+    {
+        if(m_verbose)
+            yInfo() << "setField with target " << target << " : " << key << " " << value.toString();
+
+        Property delta;
+        delta.put(key, value);
+
+        {
+            Shard &shard = shardOf(target);
+            std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+            dropIfExpired(shard, target);
+            const Property *data = lookup(shard, target);
+            if(data && data->check(key) && data->find(key) == value)
+                return true;
+            std::int64_t growth = static_cast<std::int64_t>(key.size() + valueBytes(value));
+            if(data && data->check(key))
+                growth -= static_cast<std::int64_t>(key.size() + valueBytes(data->find(key)));
+            Entry &entry = writable(shard, target);
+            entry.data.put(key, value);
+            entry.version = ++m_version;
+            account(target, entry, growth);
+            if(SpatialIndex::isPositionKey(key))
+                m_index->update(target, entry.data);
+            if(m_journal.isOpen())
+                m_journal.logSet(target, delta);
+            publishUpdate(target, entry.version, false, delta);
+        }
+        enforceBudget();
+        return true;
+    }
+
+    std::vector<yarp::os::Property> getMany(const std::vector<std::string>& targets) override
+    {
+        // all the shards involved are locked together, so that the contents are consistent with each other
+        std::vector<std::shared_lock<std::shared_timed_mutex>> locks;
+        for(size_t shard : shardsOf(targets))
+            locks.emplace_back(m_shards[shard].mutex);
+
+        std::vector<Property> ret;
+        ret.reserve(targets.size());
+        for(const auto &target : targets)
+        {
+            const Property *data = lookup(shardOf(target), target);
+            ret.push_back(data ? *data : Property());
+        }
+        return ret;
+    }
+
+    VersionedData getDataIfChanged(const std::string& target, const std::int64_t knownVersion) override
+    {
+        VersionedData ret;
+        ret.version = 0;
+        ret.changed = true;
+
+        Shard &shard = shardOf(target);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        const Property *data = lookup(shard, target, &ret.version);
+        if(!data)
+            return ret;
+
+        ret.changed = (ret.version != knownVersion);
+        if(ret.changed)
+            ret.data = *data;
+        return ret;
     }
 
     std::vector<std::string> listTarget() override
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
         std::vector<std::string> ret;
-        for(auto entry : m_storage)
         {
-            yInfo() << entry.first << entry.second.toString();
-            ret.emplace_back(entry.first);
+            auto locks = lockAllShared();
+            forEachInOrder("", "", [&](const std::string &target, const Property &, std::int64_t)
+            {
+                ret.emplace_back(target);
+                return true;
+            });
         }
+        if(m_verbose)
+            yInfo() << "listTarget: " << ret.size() << " targets";
         return ret;
     }
 
+    TargetPage listTargets(const std::string& prefix, const std::int32_t limit, const std::string& cursor) override
+    {
+        return page(prefix, limit, cursor, false);
+    }
+
+    TargetPage scan(const std::string& prefix, const std::int32_t limit, const std::string& cursor) override
+    {
+        return page(prefix, limit, cursor, true);
+    }
+
+    yarp::os::Property getMemoryStats() override
+    {
+        // bytes are tracked at each modification, only the targets are counted here
+        std::int64_t entries = 0;
+        {
+            auto locks = lockAllShared();
+            forEachTarget([&](const std::string &, const Property &, std::int64_t) { entries++; });
+        }
+
+        Property stats;
+        stats.put("entries",        Value::makeInt64(entries));
+        stats.put("bytes",          Value::makeInt64(m_bytes));
+        stats.put("max_bytes",      Value::makeInt64(m_maxBytes));
+        stats.put("evictions",      Value::makeInt64(m_evictions));
+        stats.put("expirations",    Value::makeInt64(m_expirations));
+        return stats;
+    }
+
     // erase a single entry
     void clearData(const std::string &target)  override
     {
-        m_storage.erase (m_storage.find(target));
+        Shard &shard = shardOf(target);
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        if(!lookup(shard, target))
+            return;
+        drop(shard, target);
     }
 
     // erase all the memory
     void clearAll() override
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_storage.clear();
+        resetTo(std::make_shared<const Storage>());
     }
 
+    // back to the initial values: the targets written since the last reset are dropped, nothing is copied
     void resetData() override
     {
-        m_storage.clear();
-        m_storage = m_initialization_values;
+        resetTo(m_initialValues);
+    }
+
+    bool setData(const std::string& target, const PropertyEntries& datum) override
+    {
+        return write(target, datum, false, 0.0);
     }
 
-    bool setData(const std::string& target, const yarp::os::Property& datum) override
+    bool setDataWithTTL(const std::string& target, const PropertyEntries& datum, const double ttl) override
     {
-        /* Using fromString(toString) is the only way known to merge two properties together.
-         * In case the pair <key, value> exists only in the lhs, it'll be kept as is
-         * In case the pair <key, value> exists only in the rhs, it'll be copied into the lhs
-         * In case the pair <key, value> exists in both lhs and rhs, the one in the lhs will
-         * overwrite the one in lhs.
+        return write(target, datum, true, ttl);
+    }
+
+    // setData, also replacing the expiry of <target> if <withTTL>
+    bool write(const std::string& target, const yarp::os::Property& datum, bool withTTL, double ttl)
+    {
+        /* Merge <datum> into the stored property of <target>:
+         * In case the pair <key, value> exists only in the stored property, it'll be kept as is
+         * In case the pair <key, value> exists only in datum, it'll be copied into the stored one
+         * In case the pair <key, value> exists in both, the one in datum will overwrite the stored one.
          *
-         * See https://www.yarp.it/classyarp_1_1os_1_1Property.html for documentation
+         * Property has no way to iterate over its keys: <datum> is a PropertyEntries, read from the
+         * network along with its entries, and the entries are copied over in place.
          */
-        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_verbose)
+            yInfo() << "setData with target " << target << " and params " << datum.toString();
+        Bottle entries = propertyEntries(datum);
+
+        {
+            Shard &shard = shardOf(target);
+            std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+            dropIfExpired(shard, target);
+            Entry &entry = writable(shard, target);
+            std::int64_t growth = mergeGrowth(entry.data, entries);
+            mergeProperty(entry.data, entries);
+            entry.version = ++m_version;
+            if(withTTL)
+                setExpiry(shard, entry, ttl > 0.0 ? Time::now() + ttl : 0.0);
+            account(target, entry, growth);
+            if(SpatialIndex::movesTarget(datum))
+                m_index->update(target, entry.data);
+            if(m_journal.isOpen())
+            {
+                if(withTTL)
+                    m_journal.logSet(target, datum, entry.expiry);
+                else
+                    m_journal.logSet(target, datum);
+            }
+            publishUpdate(target, entry.version, false, datum);
+        }
+        enforceBudget();
+        return true;
+    }
 
-        yInfo() << "setData with target " << target << " and params " << datum.toString();
+    bool setMany(const std::vector<std::string>& targets, const std::vector<yarp::os::Property>& data) override
+    {
+        if(targets.size() != data.size())
+        {
+            yError() << "setMany: got " << targets.size() << " targets and " << data.size() << " data";
+            return false;
+        }
+
+        std::vector<Bottle> entries;
+        entries.reserve(data.size());
+        for(const auto &datum : data)
+            entries.push_back(propertyEntries(datum));
+
+        {
+            // all the shards involved are locked together, so that readers see either none or all the writes
+            std::vector<std::unique_lock<std::shared_timed_mutex>> locks;
+            for(size_t shard : shardsOf(targets))
+                locks.emplace_back(m_shards[shard].mutex);
+
+            for(const auto &target : targets)
+                dropIfExpired(shardOf(target), target);
+
+            // a single record, the writes are recovered together as well
+            if(m_journal.isOpen())
+                m_journal.logSetMany(targets, data);
+
+            for(size_t i=0; i<targets.size(); i++)
+            {
+                if(m_verbose)
+                    yInfo() << "setMany with target " << targets[i] << " and params " << data[i].toString();
 
-        m_storage[target].fromString(datum.toString(), false);
+                Entry &entry = writable(shardOf(targets[i]), targets[i]);
+                std::int64_t growth = mergeGrowth(entry.data, entries[i]);
+                mergeProperty(entry.data, entries[i]);
+                entry.version = ++m_version;
+                account(targets[i], entry, growth);
+                if(SpatialIndex::movesTarget(data[i]))
+                    m_index->update(targets[i], entry.data);
+                publishUpdate(targets[i], entry.version, false, data[i]);
+            }
+        }
+        enforceBudget();
         return true;
     }
 
+    bool watch(const std::string& pattern, const std::string& subscriber) override
+    {
+        if(pattern.empty())
+            return false;
+
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(m_watchMutex);
+            if(m_subscribers[subscriber].insert(pattern).second)
+                m_watched[pattern]++;
+            m_anyWatched = true;
+        }
+
+        // send the current content of the matching targets, changes will follow.
+        // Also when the subscriber watched the pattern already, e.g. it reconnected and its copy may have gaps
+        auto locks = lockAllShared();
+        forEachTarget([&](const std::string &target, const Property &data, std::int64_t version)
+        {
+            if(matches(pattern, target))
+                publishUpdate(target, version, true, data);
+        });
+        return true;
+    }
+
+    bool unwatch(const std::string& pattern, const std::string& subscriber) override
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(m_watchMutex);
+        auto watcher = m_subscribers.find(subscriber);
+        if(watcher == m_subscribers.end() || watcher->second.erase(pattern) == 0)
+            return false;
+
+        if(watcher->second.empty())
+            m_subscribers.erase(watcher);
+        forget(pattern);
+        return true;
+    }
+
+    // one subscriber less for <pattern>. To be called with m_watchMutex held
+    void forget(const std::string &pattern)
+    {
+        auto it = m_watched.find(pattern);
+        if(it != m_watched.end() && --it->second == 0)
+            m_watched.erase(it);
+        m_anyWatched = !m_watched.empty();
+    }
+
+    // drop the patterns of the subscribers gone without unwatching them, e.g. a BT engine stopped
+    void checkSubscribers()
+    {
+        std::vector<std::string> subscribers;
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(m_watchMutex);
+            for(const auto &watcher : m_subscribers)
+                subscribers.push_back(watcher.first);
+        }
+
+        // asks the name server, out of the lock
+        std::vector<std::string> gone;
+        for(const auto &subscriber : subscribers)
+        {
+            if(!Network::isConnected(m_updates_port.getName(), subscriber))
+                gone.push_back(subscriber);
+        }
+
+        std::lock_guard<std::shared_timed_mutex> lock(m_watchMutex);
+        for(const auto &subscriber : gone)
+        {
+            auto watcher = m_subscribers.find(subscriber);
+            if(watcher == m_subscribers.end())
+                continue;
+            for(const auto &pattern : watcher->second)
+                forget(pattern);
+            m_subscribers.erase(watcher);
+            if(m_verbose)
+                yInfo() << "Subscriber " << subscriber << " is gone, its watches are dropped";
+        }
+    }
+
+    std::vector<SpatialMatch> findInRadius(const std::string& mapId, const double x, const double y, const double z, const double radius) override
+    {
+        const double center[3] = {x, y, z};
+        return readMatches(m_index->inRadius(mapId, center, radius));
+    }
+
+    std::vector<SpatialMatch> findNearest(const std::string& mapId, const double x, const double y, const double z, const std::int32_t count) override
+    {
+        if(count <= 0)
+            return {};
+        const double center[3] = {x, y, z};
+        return readMatches(m_index->nearest(mapId, center, static_cast<size_t>(count)));
+    }
+
     double getPeriod()
     {
         // module periodicity (seconds), called implicitly by the module.
-        return 1.0;
+        return m_period;
     }
 
     // This is our main function. Will be called periodically every getPeriod() seconds
     bool updateModule()
     {
-        //cout << "[" << count << "]" << " updateModule..." << endl;
+        expire();
+
+        if(m_anyWatched && yarp::os::Time::now() - m_lastSubscribersCheck >= SUBSCRIBERS_CHECK_PERIOD)
+        {
+            checkSubscribers();
+            m_lastSubscribersCheck = yarp::os::Time::now();
+        }
+
+        if(m_journal.isOpen())
+        {
+            // sync the last modifications, even if no more arrive
+            m_journal.sync();
+
+            if(m_journal.records() >= m_snapshotRecords ||
+               (m_journal.records() > 0 && yarp::os::Time::now() - m_lastSnapshot >= m_snapshotPeriod))
+                takeSnapshot();
+        }
         return true;
     }
 
     bool configure(yarp::os::ResourceFinder &rf)
     {
+        // log every access only if requested, the blackboard is polled at each tick
+        m_verbose = rf.check("verbose");
+        setVerbose(m_verbose);
+
         m_blackboard_port.open("/blackboard/rpc:s");
+        m_updates_port.open("/blackboard/updates:o");
 
         // Attach BlackBoard thrift message parser
         BlackBoardWrapper::yarp().attachAsServer(m_blackboard_port);
 
         Bottle p(rf.toString());
+        Storage initialValues;
 
         yInfo() << p.toString();
 
@@ -194,17 +1124,55 @@ public:
                         abl->add(data.get(k));
                     }
                     prop.put(propKey, a);
-                    m_initialization_values[mapKey] = prop;
+                    initialValues[mapKey] = prop;
                 }
             }
         }
+        m_initialValues = std::make_shared<const Storage>(std::move(initialValues));
+        m_maxBytes      = rf.check("max_bytes", Value(0)).asInt64();
+        m_index.reset(new SpatialIndex(rf.check("index_cell", Value(1.0)).asFloat64()));
         resetData();
+
+        // restore the content learned before the last shutdown, if any
+        if(rf.check("persistence_dir"))
+        {
+            m_persistent = true;
+            std::string dir = rf.find("persistence_dir").asString();
+            BlackBoardJournal::Durability durability;
+            if(!BlackBoardJournal::fromString(rf.check("durability", Value("batched")).asString(), durability))
+            {
+                yError() << "Invalid <durability>, it must be one of: always, batched, off";
+                return false;
+            }
+            double syncPeriod = rf.check("sync_period", Value(0.1)).asFloat64();
+            m_snapshotPeriod  = rf.check("snapshot_period", Value(60.0)).asFloat64();
+            m_snapshotRecords = rf.check("snapshot_records", Value(10000)).asInt32();
+
+            if(!m_journal.open(dir, durability, syncPeriod))
+                return false;
+
+            Storage  content;
+            Expiries expiries;
+            if(m_journal.recover(content, expiries, *m_initialValues))
+                restore(content, expiries);
+            if(durability == BlackBoardJournal::DURABILITY_BATCHED)
+                m_period = std::min(m_period, syncPeriod);
+
+            // start from a compact snapshot of the recovered content
+            takeSnapshot();
+        }
+
+        // last step: RFModule does not call close() when configure fails, the thread would not be joined.
+        // Updates queued so far are sent as soon as it starts
+        m_publishing    = true;
+        m_updatesThread = std::thread(&BlackBoard::runUpdates, this);
         return true;
     }
 
     bool interruptModule()
     {
         m_blackboard_port.interrupt();
+        m_updates_port.interrupt();
         return true;
     }
 
@@ -212,6 +1180,17 @@ public:
     bool close()
     {
         m_blackboard_port.close();
+        if(m_updatesThread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_updatesMutex);
+                m_publishing = false;
+            }
+            m_updatesCv.notify_one();
+            m_updatesThread.join();
+        }
+        m_updates_port.close();
+        m_journal.close();
         return true;
     }    
 };
@@ -302,6 +302,7 @@ public:
     /****************************************************************/
     bool close() override
     {
+        close_TickServer();
         grasp_module_port.close();
 //        grasp_module_start_halt_port.close();
         toMonitor_port.close();
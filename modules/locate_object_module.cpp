@@ -14,6 +14,7 @@
 
 //standard imports
 #include <cmath>
+#include <chrono>
 #include <string>
 
 //YARP imports
@@ -203,7 +204,9 @@ class LocateBottle : public RFModule, public TickServer
         return true;
     }
 
-    bool writeObjectDataToBlackboard(const std::string &objectName, Vector &position, Vector &shape)
+    // pose, shape and detection status are written with a single message, so readers never see
+    // the object located without its pose
+    bool writeObjectDataToBlackboard(const std::string &objectName, Vector &position, Vector &shape, bool status)
     {
         if(position.size() != 3)
         {
@@ -226,6 +229,7 @@ class LocateBottle : public RFModule, public TickServer
         // Convert vector into a Value for property
         Property::copyPortable(shape, *tmpVal2.asList());
         p.put("shape", tmpVal2);
+        p.put("located", status);
 
         if(!m_blackboardClient.setData(objectName, p))
         {
@@ -233,7 +237,7 @@ class LocateBottle : public RFModule, public TickServer
             return false;
         }
 
-        yInfo() << objectName << "Pose & Shape written to blackboard";
+        yInfo() << objectName << "Pose & Shape written to blackboard, <located> set to" << (status?"True":"False");
         return true;
     }
 
@@ -283,6 +287,7 @@ class LocateBottle : public RFModule, public TickServer
 */
         Vector position3D;
         Vector objectShape;
+        CancellationToken halt = getCancellationToken(target);
 
         bool objectLocated = this->getObjectPosition(target.target, position3D);
         if(objectLocated) objectLocated = this->getObjectShape(target.target, objectShape);
@@ -297,20 +302,17 @@ class LocateBottle : public RFModule, public TickServer
                 return BT_FAILURE;
             }
 
-            // wait until object is found or timeout
-
-            double t0 = yarp::os::Time::now();
-            while((!objectLocated) && (yarp::os::Time::now()-t0 < timeOut))
+            // wait until object is found or timeout, a halt interrupts the wait immediately
+            objectLocated = halt.waitUntil([&]
+                                           {
+                                               bool located = this->getObjectPosition(target.target, position3D);
+                                               if(located) located = this->getObjectShape(target.target, objectShape);
+                                               return located;
+                                           },
+                                           std::chrono::duration<double>(timeOut), std::chrono::milliseconds(100));
+            if(halt.isCancelled())
             {
-                if(isHaltRequested(target))
-                {
-                    return BT_HALTED;
-                }
-
-                objectLocated = this->getObjectPosition(target.target, position3D);
-                if(objectLocated) objectLocated = this->getObjectShape(target.target, objectShape);
-
-                yarp::os::Time::delay(0.1);
+                return BT_HALTED;
             }
 
 
@@ -356,17 +358,12 @@ class LocateBottle : public RFModule, public TickServer
             return BT_FAILURE;
         }
 
-        if(isHaltRequested(target))
+        if(halt.isCancelled())
         {
             return BT_HALTED;
         }
 
-        if(!this->writeObjectDataToBlackboard(target.target, position3D, objectShape))
-        {
-            return BT_FAILURE;
-        }
-
-        if(!this->writeObjectDetectionStatusToBlackboard(target.target, true))
+        if(!this->writeObjectDataToBlackboard(target.target, position3D, objectShape, true))
         {
             return BT_FAILURE;
         }
@@ -511,6 +508,7 @@ class LocateBottle : public RFModule, public TickServer
     /****************************************************************/
     bool close() override
     {
+        close_TickServer();
         object_properties_collector_port.close();
         point_cloud_read_port.close();
         find_superquadric_port.close();
@@ -30,7 +30,13 @@ using namespace yarp::os;
 using namespace yarp::dev;
 using namespace yarp::BT_wrappers;
 
-class moveJoint_module : public TickServer, public RFModule
+// state of a single homeArms action, reset each time the action starts
+struct HomeArmsState
+{
+    bool done_arm {false};
+};
+
+class moveJoint_module : public TickServer_withData<HomeArmsState>, public RFModule
 {
 private:
     PolyDriver  headDev;
@@ -39,7 +45,7 @@ private:
     string robotPort_prefix{"/cer"};
     bool done_headLeft  {false}, sent_headLeft  {false};
     bool done_headFront {false}, sent_headFront {false};
-    bool done_arm       {false}, sent_arm       {false};
+    bool sent_arm       {false};
     IPositionControl  *headPos, *leftArmPos, *rightArmPos;
     IEncoders         *headEnc, *leftArmEnc, *rightArmEnc;
 
@@ -135,8 +141,9 @@ public:
             double enc[8];
             leftArmEnc->getEncoders(enc);
 
-            // TBD: there should be a instance of 'done_arm' flag for each target!! Place it in the map!
-            while(!done_arm && (!isHaltRequested(target)))
+            bool &done_arm = getData(target).done_arm;
+            CancellationToken halt = getCancellationToken(target);
+            while(!done_arm && (!halt.isCancelled()))
             {
                 done_arm = true;
                 for(int i=0; i<8; i++)
@@ -146,7 +153,7 @@ public:
                 }
 
                 done_arm ?  ret = BT_SUCCESS :  ret = BT_RUNNING;
-                std::this_thread::sleep_for( std::chrono::milliseconds(200));
+                halt.waitFor(std::chrono::milliseconds(200));
             }
         }
 
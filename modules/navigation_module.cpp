@@ -56,6 +56,7 @@ public:
     ReturnStatus request_tick(const ActionID &target, const yarp::os::Property &params = {}) override
     {
         ReturnStatus ret = BT_ERROR;
+        CancellationToken halt = getCancellationToken(target);
 
         // Retrieve absolute position of 'target' from params.
         // target here is the Goal name (e.g. kitchen)
@@ -106,7 +107,8 @@ public:
         yInfo() << "response is " << reply.toString();
 
         // wait a bit to avoid concurrency issue
-        yarp::os::Time::delay(0.2);
+        if(halt.waitFor(0.2))
+            return BT_HALTED;
 
         // TODO: quick and dirty ... use enum instead?
         bool targetIsRoom = (type == "room") ? true : false;
@@ -115,7 +117,7 @@ public:
         iNav->gotoTargetByAbsoluteLocation(desiredLoc);
 
         ret = BT_RUNNING;
-        while( (ret == BT_RUNNING) && (!isHaltRequested(target)))
+        while( (ret == BT_RUNNING) && (!halt.isCancelled()))
         {
             NavigationStatusEnum navStat;
             iNav->getNavigationStatus(navStat);
@@ -151,17 +153,16 @@ public:
                     yDebug() << "Robot reached target <" + target.target + "> location.";
                 }
             }
-            yarp::os::Time::delay(0.1);
+            // returns immediately on halt
+            halt.waitFor(0.1);
         }
 
         if(ret == BT_SUCCESS)
         {
-            Property p;
-            p.put("robotAt", Value(true));
-            m_blackboardClient.setData(target.target, p);
+            m_blackboardClient.setField(target.target, "robotAt", Value(true));
             yDebug() << "setting robotAt to true for target " << target.target;
         }
-        return (isHaltRequested(target) ? BT_HALTED : ret);
+        return (halt.isCancelled() ? BT_HALTED : ret);
     }
 
     ReturnStatus request_halt(  const ActionID &target, const yarp::os::Property &params = {}) override
@@ -248,6 +249,7 @@ public:
 
     bool close()
     {
+        close_TickServer();
         ddNavClient.close();
         return true;
     }
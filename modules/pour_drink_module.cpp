@@ -334,6 +334,7 @@ public:
     /****************************************************************/
     bool close() override
     {
+        close_TickServer();
         action_module_port.close();
         reaching_calibration_port.close();
         return true;
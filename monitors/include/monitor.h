@@ -66,6 +66,7 @@ private:
 
     // callback for event port
     bool read(yarp::os::ConnectionReader& connection);
+    bool processEvent(const yarp::BT_wrappers::MonitorMsg &monitorMsg);
     double startTime;
     bool isEnvironment {false};
 
@@ -4,6 +4,7 @@
 #include <iomanip>
 #include <yarp/os/LogStream.h>
 #include <yarp/os/Time.h>
+#include <yarp/os/Bottle.h>
 
 using namespace std;
 using namespace yarp::os;
@@ -86,14 +87,39 @@ bool Monitor::respond(const Bottle &command, Bottle &reply)
 // Callback from 'event' port
 bool Monitor::read(ConnectionReader& connection)
 {
-    // Process events sent using the proper thrift message
-     MonitorMsg monitorMsg;
-     if(!monitorMsg.read(connection))
-     {
-         yError() << "Error reading the message";
-         return false;
-     }
+    // Events are published in batches: a Bottle holding a (skill target event) list, i.e. the
+    // fields of a MonitorMsg, for each event. A single MonitorMsg is accepted as well.
+    Bottle batch;
+    if(!batch.read(connection))
+    {
+        yError() << "Error reading the message";
+        return false;
+    }
+
+    if(batch.size() > 0 && !batch.get(0).isList())
+    {
+        MonitorMsg monitorMsg(batch.get(0).asString(), batch.get(1).asString(), batch.get(2).asString());
+        return processEvent(monitorMsg);
+    }
 
+    bool ret = true;
+    for(size_t i=0; i<batch.size(); i++)
+    {
+        Bottle *fields = batch.get(i).asList();
+        if(!fields || fields->size() < 3)
+        {
+            yError() << "Malformed event in message: " << batch.get(i).toString();
+            ret = false;
+            continue;
+        }
+        MonitorMsg monitorMsg(fields->get(0).asString(), fields->get(1).asString(), fields->get(2).asString());
+        ret &= processEvent(monitorMsg);
+    }
+    return ret;
+}
+
+bool Monitor::processEvent(const MonitorMsg &monitorMsg)
+{
      if(!isEnvironment)
      {
          if(monitorMsg.skill == getName())